@@ -0,0 +1,143 @@
+﻿#include "Attacks.h"
+
+Magic rookMagics[64];
+Magic bishopMagics[64];
+
+Bitboard betweenTable[64][64];
+Bitboard lineTable[64][64];
+
+namespace {
+
+    Bitboard rookTable[0x19000];               // 102400 ulaza za sva polja topa
+    Bitboard bishopTable[0x1480];              // 5248 ulaza za sva polja lovca
+
+    const int rookDirections[4][2] = { {0, 1}, {1, 0}, {0, -1}, {-1, 0} };
+    const int bishopDirections[4][2] = { {1, 1}, {1, -1}, {-1, 1}, {-1, -1} };
+
+    // Spori proračun napada korak po korak, koristi se samo pri popunjavanju tabela
+    Bitboard slidingAttacks(int square, Bitboard occupied, const int directions[4][2]) {
+        Bitboard attacks = 0;
+        for (int d = 0; d < 4; ++d) {
+            int row = squareRow(square) + directions[d][0];
+            int col = squareColumn(square) + directions[d][1];
+
+            while (row >= 0 && row < 8 && col >= 0 && col < 8) {
+                Bitboard bit = squareBB(makeSquare(row, col));
+                attacks |= bit;
+                if (occupied & bit) {
+                    break;
+                }
+                row += directions[d][0];
+                col += directions[d][1];
+            }
+        }
+        return attacks;
+    }
+
+    // Relevantna polja: napadi na praznoj tabli bez posljednjeg polja na svakom pravcu
+    Bitboard relevantMask(int square, const int directions[4][2]) {
+        Bitboard mask = 0;
+        for (int d = 0; d < 4; ++d) {
+            int row = squareRow(square) + directions[d][0];
+            int col = squareColumn(square) + directions[d][1];
+
+            while (row + directions[d][0] >= 0 && row + directions[d][0] < 8 &&
+                col + directions[d][1] >= 0 && col + directions[d][1] < 8) {
+                mask |= squareBB(makeSquare(row, col));
+                row += directions[d][0];
+                col += directions[d][1];
+            }
+        }
+        return mask;
+    }
+
+    // Magični brojevi za raspored polja A8 = 0 ... H1 = 63, pronađeni jednom pretragom
+    // slučajnih rijetkih brojeva, tako da se pri pokretanju samo popunjavaju tabele
+    const Bitboard rookMagicNumbers[64] = {
+        0x0080068051E04000ULL, 0x0040001000402000ULL, 0x0080100020008008ULL, 0x4E000A0010208440ULL,
+        0x4200040802002010ULL, 0x0100010008020400ULL, 0x9080608019000600ULL, 0x8100020080204100ULL,
+        0x4103800480400020ULL, 0x8015004004802100ULL, 0x000200108A002040ULL, 0x0801000821001000ULL,
+        0x0015000500080070ULL, 0x0120800400800200ULL, 0x0109000432001100ULL, 0x020080055B000080ULL,
+        0x0080004000402002ULL, 0x5260848020004008ULL, 0x2402020014402080ULL, 0x3000808010000802ULL,
+        0x0304018004810800ULL, 0x0000808004000200ULL, 0x0002040001500248ULL, 0x0012020000408401ULL,
+        0x8440008080004020ULL, 0x0804200840100040ULL, 0x0820008080201000ULL, 0x2080100100082100ULL,
+        0x0001000500100800ULL, 0x00A1000900028400ULL, 0x0100100400C80102ULL, 0x000001120000A044ULL,
+        0x800080C004800620ULL, 0x4040081000202000ULL, 0x0D08802008801000ULL, 0x1000800800801004ULL,
+        0x1004000801010010ULL, 0x0402800400800200ULL, 0x0004080204008110ULL, 0x0000404082000401ULL,
+        0x00C0118861408000ULL, 0x1100220081020048ULL, 0x09A0430420050010ULL, 0x0000082200420010ULL,
+        0x2110080004008080ULL, 0x2004201040680104ULL, 0x1106001451820008ULL, 0x0002224104820014ULL,
+        0x00800C8044210500ULL, 0x02A0200040100040ULL, 0x040100A0001E4100ULL, 0x00204023108A0200ULL,
+        0x2400080080040080ULL, 0x1289008400020900ULL, 0x0002088250010400ULL, 0x0001006084010200ULL,
+        0x0001023480002141ULL, 0x0006400021810015ULL, 0x8400100840200101ULL, 0x40003000A1000825ULL,
+        0x1002011008200402ULL, 0x100D000400080201ULL, 0x0020048806102904ULL, 0x8401000020804201ULL
+    };
+
+    const Bitboard bishopMagicNumbers[64] = {
+        0x4C40240122060016ULL, 0x8048110404004A80ULL, 0x8004440410414020ULL, 0x021C410060405000ULL,
+        0x80CD1040D0480812ULL, 0x0002021104000082ULL, 0x08440082A8200001ULL, 0x00202A0800841002ULL,
+        0x0200C40810842088ULL, 0x60C0081000C08901ULL, 0x00A3D0040042510CULL, 0x1C00110400808541ULL,
+        0x0400820211084005ULL, 0x0000008860080800ULL, 0x002002020202C000ULL, 0x0400344E08040A81ULL,
+        0x812800102098A080ULL, 0x00202010823A2040ULL, 0x4086400800830201ULL, 0x5008012A22004000ULL,
+        0x0004801C00A00000ULL, 0x0000400200505400ULL, 0x0480408401080820ULL, 0x8000400029082824ULL,
+        0x0008880804501000ULL, 0x0001600048084100ULL, 0x0108220624040400ULL, 0x0008080000820002ULL,
+        0xC804040010410041ULL, 0x01080A0040208400ULL, 0x2018030480A88800ULL, 0x4040410020410810ULL,
+        0x1108044010100210ULL, 0x084A100400029800ULL, 0x0801080100820C00ULL, 0x8010400808108200ULL,
+        0x0084008400020500ULL, 0x0002004200290481ULL, 0x0010150200032090ULL, 0x8404042220404102ULL,
+        0x0302080308004008ULL, 0x1200420820000408ULL, 0x0802002024200800ULL, 0x4020824208000084ULL,
+        0x000002020C008200ULL, 0x2C40208081000882ULL, 0x2082223441000401ULL, 0x8804080081101020ULL,
+        0x4401011002220808ULL, 0x81020C4202100000ULL, 0x4005004404040308ULL, 0x0820400C42020001ULL,
+        0x0020206421820010ULL, 0x0150401001424008ULL, 0x02A20242020C0608ULL, 0x5020110109011200ULL,
+        0x2050840108410401ULL, 0x0100090880842108ULL, 0x220008960142187AULL, 0x1111028880208820ULL,
+        0x4400200042028200ULL, 0x4400010802084206ULL, 0x0000400242040100ULL, 0x0002201104010944ULL
+    };
+
+    void initMagics(Magic magics[64], const Bitboard magicNumbers[64], Bitboard* table, const int directions[4][2]) {
+        for (int square = 0; square < 64; ++square) {
+            Magic& m = magics[square];
+            m.mask = relevantMask(square, directions);
+            m.magic = magicNumbers[square];
+            m.shift = 64 - popCount(m.mask);
+            m.attacks = table;
+
+            // Prođi kroz sve podskupove maske (Carry-Rippler) i upiši napade
+            int size = 0;
+            Bitboard subset = 0;
+            do {
+                m.attacks[m.index(subset)] = slidingAttacks(square, subset, directions);
+                ++size;
+                subset = (subset - m.mask) & m.mask;
+            } while (subset);
+
+            table += size;
+        }
+    }
+
+    struct AttacksInitializer {
+        AttacksInitializer() { initAttacks(); }
+    } attacksInitializer;
+}
+
+void initAttacks() {
+    initMagics(rookMagics, rookMagicNumbers, rookTable, rookDirections);
+    initMagics(bishopMagics, bishopMagicNumbers, bishopTable, bishopDirections);
+
+    for (int a = 0; a < 64; ++a) {
+        for (int b = 0; b < 64; ++b) {
+            betweenTable[a][b] = 0;
+            lineTable[a][b] = 0;
+
+            if (a == b) {
+                continue;
+            }
+
+            if (rookAttacks(a, 0) & squareBB(b)) {
+                betweenTable[a][b] = rookAttacks(a, squareBB(b)) & rookAttacks(b, squareBB(a));
+                lineTable[a][b] = (rookAttacks(a, 0) & rookAttacks(b, 0)) | squareBB(a) | squareBB(b);
+            }
+            else if (bishopAttacks(a, 0) & squareBB(b)) {
+                betweenTable[a][b] = bishopAttacks(a, squareBB(b)) & bishopAttacks(b, squareBB(a));
+                lineTable[a][b] = (bishopAttacks(a, 0) & bishopAttacks(b, 0)) | squareBB(a) | squareBB(b);
+            }
+        }
+    }
+}
@@ -0,0 +1,97 @@
+﻿#ifndef ATTACKS_H
+#define ATTACKS_H
+
+#include "Bitboard.h"
+
+#if defined(USE_PEXT)
+#include <immintrin.h>
+#endif
+
+// Magic bitboard za jedno polje: napadi topa / lovca za bilo koju zauzetost
+// dobijaju se jednim pristupom tabeli. Sa USE_PEXT (x64, BMI2) indeks se računa instrukcijom PEXT.
+struct Magic {
+    Bitboard mask;                             // Relevantna polja (bez ivica table)
+    Bitboard magic;                            // Magični množilac
+    Bitboard* attacks;                         // Početak dijela tabele za ovo polje
+    unsigned int shift;                        // 64 - broj bitova u maski
+
+    unsigned int index(Bitboard occupied) const {
+#if defined(USE_PEXT)
+        return (unsigned int)_pext_u64(occupied, mask);
+#else
+        return (unsigned int)(((occupied & mask) * magic) >> shift);
+#endif
+    }
+};
+
+extern Magic rookMagics[64];
+extern Magic bishopMagics[64];
+
+extern Bitboard betweenTable[64][64];           // Polja strogo između dva polja na istoj liniji
+extern Bitboard lineTable[64][64];              // Cijela linija kroz dva polja (red, kolona ili dijagonala)
+
+// Popunjava tabele topa i lovca, poziva se automatski prije main()
+void initAttacks();
+
+// Napadi skakača, kralja i pijuna se računaju pri kompajliranju, bez troška pri pokretanju
+struct SquareTable {
+    Bitboard squares[64];
+
+    constexpr Bitboard operator[](int square) const { return squares[square]; }
+};
+
+constexpr int knightOffsets[8][2] = { {2, 1}, {2, -1}, {-2, 1}, {-2, -1}, {1, 2}, {1, -2}, {-1, 2}, {-1, -2} };
+constexpr int kingOffsets[8][2] = { {0, 1}, {1, 0}, {0, -1}, {-1, 0}, {1, 1}, {1, -1}, {-1, 1}, {-1, -1} };
+constexpr int pawnCaptureOffsets[2][2][2] = { { {-1, -1}, {-1, 1} }, { {1, -1}, {1, 1} } };   // Bijeli ide ka redu 0, crni ka redu 7
+
+// Skup polja na koja se stiže jednim skokom za svaki od datih pomaka, za svih 64 polja
+template <int N>
+constexpr SquareTable makeLeaperTable(const int (&offsets)[N][2]) {
+    SquareTable table{};
+    for (int square = 0; square < 64; ++square) {
+        for (int i = 0; i < N; ++i) {
+            int row = squareRow(square) + offsets[i][0];
+            int col = squareColumn(square) + offsets[i][1];
+            if (row >= 0 && row < 8 && col >= 0 && col < 8) {
+                table.squares[square] |= squareBB(makeSquare(row, col));
+            }
+        }
+    }
+    return table;
+}
+
+constexpr SquareTable knightAttackTable = makeLeaperTable(knightOffsets);
+constexpr SquareTable kingAttackTable = makeLeaperTable(kingOffsets);
+constexpr SquareTable pawnAttackTable[2] = { makeLeaperTable(pawnCaptureOffsets[0]), makeLeaperTable(pawnCaptureOffsets[1]) };
+
+// Provjera na ručno izračunatim poljima (A8 = 0, E4 = 36, H1 = 63)
+static_assert(knightAttackTable[0] == (squareBB(10) | squareBB(17)), "Skakač na A8 napada C7 i B6");
+static_assert(knightAttackTable[36] == (squareBB(19) | squareBB(21) | squareBB(26) | squareBB(30) |
+    squareBB(42) | squareBB(46) | squareBB(51) | squareBB(53)), "Skakač na E4 napada osam polja");
+static_assert(kingAttackTable[63] == (squareBB(54) | squareBB(55) | squareBB(62)), "Kralj na H1 napada G2, H2 i G1");
+static_assert(kingAttackTable[36] == (squareBB(27) | squareBB(28) | squareBB(29) | squareBB(35) |
+    squareBB(37) | squareBB(43) | squareBB(44) | squareBB(45)), "Kralj na E4 napada osam polja");
+static_assert(pawnAttackTable[0][52] == (squareBB(43) | squareBB(45)), "Bijeli pijun na E2 napada D3 i F3");
+static_assert(pawnAttackTable[1][8] == squareBB(17), "Crni pijun na A7 napada samo B6");
+
+constexpr Bitboard knightAttacks(int square) { return knightAttackTable[square]; }
+constexpr Bitboard kingAttacks(int square) { return kingAttackTable[square]; }
+constexpr Bitboard pawnAttacks(int colorIndex, int square) { return pawnAttackTable[colorIndex][square]; }
+inline Bitboard betweenBB(int a, int b) { return betweenTable[a][b]; }
+inline Bitboard lineBB(int a, int b) { return lineTable[a][b]; }
+
+inline Bitboard rookAttacks(int square, Bitboard occupied) {
+    const Magic& m = rookMagics[square];
+    return m.attacks[m.index(occupied)];
+}
+
+inline Bitboard bishopAttacks(int square, Bitboard occupied) {
+    const Magic& m = bishopMagics[square];
+    return m.attacks[m.index(occupied)];
+}
+
+inline Bitboard queenAttacks(int square, Bitboard occupied) {
+    return rookAttacks(square, occupied) | bishopAttacks(square, occupied);
+}
+
+#endif // ATTACKS_H
@@ -0,0 +1,59 @@
+﻿#ifndef BITBOARD_H
+#define BITBOARD_H
+
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// Bitboard - 64 bita, po jedan za svako polje table
+typedef uint64_t Bitboard;
+
+// Polja se numerišu kao red * 8 + kolona (0 = A8, 63 = H1), vidi Square.h
+constexpr int makeSquare(int row, int col) { return row * 8 + col; }
+constexpr int squareRow(int square) { return square >> 3; }
+constexpr int squareColumn(int square) { return square & 7; }
+constexpr Bitboard squareBB(int square) { return Bitboard(1) << square; }
+constexpr Bitboard rowBB(int row) { return Bitboard(0xFF) << (row * 8); }
+constexpr Bitboard columnBB(int col) { return Bitboard(0x0101010101010101) << col; }
+
+// Pomjera sva polja za offset (npr. -8 je jedan red ka A8); bitovi koji izađu sa table se gube
+constexpr Bitboard shiftBB(Bitboard b, int offset) { return offset > 0 ? b << offset : b >> -offset; }
+
+inline int popCount(Bitboard b) {
+#if defined(_MSC_VER) && defined(_WIN64)
+    return (int)__popcnt64(b);
+#elif defined(_MSC_VER)
+    return (int)(__popcnt((unsigned int)b) + __popcnt((unsigned int)(b >> 32)));
+#else
+    return __builtin_popcountll(b);
+#endif
+}
+
+// Indeks najnižeg postavljenog bita, b ne smije biti 0
+inline int lsb(Bitboard b) {
+#if defined(_MSC_VER) && defined(_WIN64)
+    unsigned long index;
+    _BitScanForward64(&index, b);
+    return (int)index;
+#elif defined(_MSC_VER)
+    unsigned long index;
+    if (_BitScanForward(&index, (unsigned long)b)) {
+        return (int)index;
+    }
+    _BitScanForward(&index, (unsigned long)(b >> 32));
+    return (int)index + 32;
+#else
+    return __builtin_ctzll(b);
+#endif
+}
+
+// Vraća najniže polje i uklanja ga iz bitboarda
+inline int popLsb(Bitboard& b) {
+    int square = lsb(b);
+    b &= b - 1;
+    return square;
+}
+
+#endif // BITBOARD_H
@@ -0,0 +1,493 @@
+﻿#include "Board.h"
+#include "Attacks.h"
+#include "Zobrist.h"
+
+namespace {
+
+    // Prava na rokadu koja ostaju kada se figura pomjeri sa ili na dato polje
+    int castlingRightsKept(int square) {
+        switch (square) {
+        case 0:  return ~BlackQueenSide;                     // A8
+        case 4:  return ~(BlackKingSide | BlackQueenSide);   // E8
+        case 7:  return ~BlackKingSide;                      // H8
+        case 56: return ~WhiteQueenSide;                     // A1
+        case 60: return ~(WhiteKingSide | WhiteQueenSide);   // E1
+        case 63: return ~WhiteKingSide;                      // H1
+        default: return ~0;
+        }
+    }
+
+    // Slova figura u FEN zapisu, redoslijed kao u PieceType; bijele figure su velika slova
+    const char fenPieceChars[6] = { 'p', 'r', 'n', 'b', 'q', 'k' };
+
+    int pieceFromFenChar(char c) {
+        char lower = (char)(c | 0x20);
+        for (int t = 0; t < 6; ++t) {
+            if (fenPieceChars[t] == lower) {
+                return t;
+            }
+        }
+        return -1;
+    }
+
+    const char* skipSpaces(const char* p) {
+        while (*p == ' ') {
+            ++p;
+        }
+        return p;
+    }
+
+    // Čita nenegativan cijeli broj; ako broja nema, value ostaje nepromijenjen
+    const char* parseNumber(const char* p, int& value) {
+        if (*p < '0' || *p > '9') {
+            return p;
+        }
+        int result = 0;
+        while (*p >= '0' && *p <= '9' && result < 100000) {
+            result = result * 10 + (*p++ - '0');
+        }
+        value = result;
+        return p;
+    }
+
+    // Upisuje nenegativan broj (najviše šest cifara) i vraća poziciju iza njega
+    char* writeNumber(char* out, int value) {
+        char digits[12];
+        int count = 0;
+        do {
+            digits[count++] = (char)('0' + value % 10);
+            value /= 10;
+        } while (value > 0 && count < 6);
+        while (count > 0) {
+            *out++ = digits[--count];
+        }
+        return out;
+    }
+}
+
+Board::Board() {
+    clear();
+}
+
+void Board::clear() {
+    for (int c = 0; c < 2; ++c) {
+        for (int t = 0; t < 6; ++t) {
+            pieces[c][t] = 0;
+        }
+        occupancy[c] = 0;
+    }
+    occupied = 0;
+    sideToMove = Color::White;
+    castlingRights = 0;
+    enPassantSquare = -1;
+    key = 0;
+    halfmoveClock = 0;
+    fullmoveNumber = 1;
+    historyTop = 0;
+    historyCount = 0;
+}
+
+void Board::placePiece(Color color, PieceType type, int square) {
+    removePiece(square);
+    togglePiece(color, type, square);
+}
+
+void Board::removePiece(int square) {
+    Color color;
+    PieceType type;
+    if (pieceAt(square, color, type)) {
+        togglePiece(color, type, square);
+    }
+}
+
+void Board::setSideToMove(Color color) {
+    if (color != sideToMove) {
+        sideToMove = color;
+        key ^= zobristSideToMove;
+    }
+}
+
+void Board::setCastlingRights(int rights) {
+    key ^= zobristCastling[castlingRights] ^ zobristCastling[rights];
+    castlingRights = rights;
+}
+
+// Ključ računat ispočetka, služi za provjeru inkrementalnog ažuriranja
+uint64_t Board::computeKey() const {
+    uint64_t result = 0;
+    for (int c = 0; c < 2; ++c) {
+        for (int t = 0; t < 6; ++t) {
+            Bitboard bb = pieces[c][t];
+            while (bb) {
+                result ^= zobristPieces[c][t][popLsb(bb)];
+            }
+        }
+    }
+    if (sideToMove == Color::Black) {
+        result ^= zobristSideToMove;
+    }
+    result ^= zobristCastling[castlingRights];
+    if (enPassantSquare >= 0) {
+        result ^= zobristEnPassantFile[squareColumn(enPassantSquare)];
+    }
+    return result;
+}
+
+// Odigrava potez po svim pravilima: uzimanje, rokada, en passant i promocija.
+// Potez se ne provjerava, pozivalac mora proslijediti jedan od mogućih poteza.
+// Stanje potrebno za vraćanje poteza se čuva na steku, bez alokacija.
+void Board::makeMove(Move move) {
+    // Boja se uzima od figure koja igra, pa potez ostaje ispravan i kada se simulira potez strane koja nije na redu
+    int from = move.from();
+    int to = move.to();
+    Color us = (occupancy[(int)Color::White] & squareBB(from)) ? Color::White : Color::Black;
+    Color them = oppositeColor(us);
+    PieceType moved = typeAt(us, from);
+
+    UndoRecord& undo = history[historyTop & (MaxHistory - 1)];
+    ++historyTop;
+    if (historyCount < MaxHistory) {
+        ++historyCount;
+    }
+
+    undo.move = move;
+    undo.movedType = moved;
+    undo.castlingRights = castlingRights;
+    undo.enPassantSquare = enPassantSquare;
+    undo.halfmoveClock = halfmoveClock;
+    undo.key = key;
+
+    // Uzimanje i potez pijunom se ne mogu vratiti, pa se prethodne pozicije više ne mogu ponoviti
+    halfmoveClock = (move.isCapture() || moved == PieceType::Pawn) ? 0 : halfmoveClock + 1;
+
+    // En passant: pijun koji se uzima stoji iza odredišnog polja
+    if (move.isCapture()) {
+        int captureSquare = move.isEnPassant() ? to + (us == Color::White ? 8 : -8) : to;
+        undo.capturedType = typeAt(them, captureSquare);
+        togglePiece(them, undo.capturedType, captureSquare);
+    }
+
+    // Promocija na posljednjem redu
+    togglePiece(us, moved, from);
+    togglePiece(us, move.isPromotion() ? move.promotion() : moved, to);
+
+    // Rokada: kralj se pomjera dva polja, top preskače kralja
+    if (move.isCastle()) {
+        int row = squareRow(from);
+        bool kingSide = move.flags() == KingCastle;
+        togglePiece(us, PieceType::Rook, makeSquare(row, kingSide ? 7 : 0));
+        togglePiece(us, PieceType::Rook, makeSquare(row, kingSide ? 5 : 3));
+    }
+
+    // Figure su već ušle u ključ kroz togglePiece, ostaju prava, en passant i strana na potezu
+    if (enPassantSquare >= 0) {
+        key ^= zobristEnPassantFile[squareColumn(enPassantSquare)];
+    }
+    key ^= zobristCastling[castlingRights];
+    castlingRights &= castlingRightsKept(from) & castlingRightsKept(to);
+    key ^= zobristCastling[castlingRights];
+
+    enPassantSquare = move.isDoublePawnPush() ? (from + to) / 2 : -1;
+    if (enPassantSquare >= 0) {
+        key ^= zobristEnPassantFile[squareColumn(enPassantSquare)];
+    }
+
+    if (us == Color::Black) {
+        ++fullmoveNumber;
+    }
+    sideToMove = them;
+    key ^= zobristSideToMove;
+}
+
+// Vraća posljednji potez odigran preko makeMove, false ako nema šta da se vrati
+bool Board::unmakeMove() {
+    if (historyCount == 0) {
+        return false;
+    }
+
+    --historyTop;
+    --historyCount;
+    const UndoRecord& undo = history[historyTop & (MaxHistory - 1)];
+    Move move = undo.move;
+    int from = move.from();
+    int to = move.to();
+
+    Color us = (occupancy[(int)Color::White] & squareBB(to)) ? Color::White : Color::Black;
+    Color them = oppositeColor(us);
+
+    togglePiece(us, move.isPromotion() ? move.promotion() : undo.movedType, to);
+    togglePiece(us, undo.movedType, from);
+
+    if (move.isCastle()) {
+        int row = squareRow(from);
+        bool kingSide = move.flags() == KingCastle;
+        togglePiece(us, PieceType::Rook, makeSquare(row, kingSide ? 5 : 3));
+        togglePiece(us, PieceType::Rook, makeSquare(row, kingSide ? 7 : 0));
+    }
+
+    if (move.isCapture()) {
+        int captureSquare = move.isEnPassant() ? to + (us == Color::White ? 8 : -8) : to;
+        togglePiece(them, undo.capturedType, captureSquare);
+    }
+
+    castlingRights = undo.castlingRights;
+    enPassantSquare = undo.enPassantSquare;
+    halfmoveClock = undo.halfmoveClock;
+    key = undo.key;
+    if (us == Color::Black) {
+        --fullmoveNumber;
+    }
+    sideToMove = us;
+    return true;
+}
+
+// Dodaje ili uklanja figuru za koju se zna boja i tip
+void Board::togglePiece(Color color, PieceType type, int square) {
+    Bitboard bit = squareBB(square);
+    pieces[(int)color][(int)type] ^= bit;
+    occupancy[(int)color] ^= bit;
+    occupied ^= bit;
+    key ^= zobristPieces[(int)color][(int)type][square];
+}
+
+PieceType Board::typeAt(Color color, int square) const {
+    Bitboard bit = squareBB(square);
+    for (int t = 0; t < 5; ++t) {
+        if (pieces[(int)color][t] & bit) {
+            return (PieceType)t;
+        }
+    }
+    return PieceType::King;
+}
+
+// Učitava poziciju iz FEN zapisa (npr. "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1").
+// Čita se direktno iz niza znakova, bez pomoćnih stringova i alokacija. Brojači poteza nisu obavezni.
+bool Board::loadFen(const char* fen) {
+    clear();
+
+    const char* p = skipSpaces(fen);
+    int row = 0;
+    int col = 0;
+    for (; *p != '\0' && *p != ' '; ++p) {
+        char c = *p;
+        if (c == '/') {
+            if (col != 8 || ++row > 7) {
+                return false;
+            }
+            col = 0;
+        }
+        else if (c >= '1' && c <= '8') {
+            col += c - '0';
+            if (col > 8) {
+                return false;
+            }
+        }
+        else {
+            int type = pieceFromFenChar(c);
+            if (type < 0 || col > 7) {
+                return false;
+            }
+            togglePiece((c >= 'a') ? Color::Black : Color::White, (PieceType)type, makeSquare(row, col));
+            ++col;
+        }
+    }
+    if (row != 7 || col != 8) {
+        return false;
+    }
+    // Bez tačno jednog kralja po strani generator poteza i makeMove nemaju smisla
+    if (popCount(pieces[(int)Color::White][(int)PieceType::King]) != 1 ||
+        popCount(pieces[(int)Color::Black][(int)PieceType::King]) != 1) {
+        return false;
+    }
+    // Više od 16 figura ili 8 pijuna po strani ne može nastati u partiji (a PieceSet ih ne može prikazati)
+    for (int c = 0; c < 2; ++c) {
+        if (popCount(occupancy[c]) > 16 || popCount(pieces[c][(int)PieceType::Pawn]) > 8) {
+            return false;
+        }
+    }
+
+    p = skipSpaces(p);
+    if (*p != 'w' && *p != 'b') {
+        return false;
+    }
+    sideToMove = (*p++ == 'b') ? Color::Black : Color::White;
+    // Kralj strane koja nije na potezu ne smije biti u šahu, inače bi prvi potez uzeo kralja
+    if (isInCheck(oppositeColor(sideToMove))) {
+        return false;
+    }
+
+    p = skipSpaces(p);
+    if (*p == '-') {
+        ++p;
+    }
+    else {
+        for (; *p != '\0' && *p != ' '; ++p) {
+            switch (*p) {
+            case 'K': castlingRights |= WhiteKingSide; break;
+            case 'Q': castlingRights |= WhiteQueenSide; break;
+            case 'k': castlingRights |= BlackKingSide; break;
+            case 'q': castlingRights |= BlackQueenSide; break;
+            default: return false;
+            }
+        }
+    }
+
+    p = skipSpaces(p);
+    if (*p == '-') {
+        ++p;
+    }
+    else if (p[0] >= 'a' && p[0] <= 'h' && (p[1] == '3' || p[1] == '6')) {
+        // Polje se prihvata samo ako je protivnički pijun upravo mogao da ga preskoči: šesti red
+        // kada je bijeli na potezu, treći kada je crni, i pijun protivnika odmah iza polja.
+        // Inače se polje zanemaruje, kao da je zapisano "-".
+        Color them = oppositeColor(sideToMove);
+        int square = makeSquare('8' - p[1], p[0] - 'a');
+        int pawnSquare = square + (sideToMove == Color::White ? 8 : -8);
+        if (p[1] == (sideToMove == Color::White ? '6' : '3') &&
+            (pieces[(int)them][(int)PieceType::Pawn] & squareBB(pawnSquare))) {
+            enPassantSquare = square;
+        }
+        p += 2;
+    }
+    else {
+        return false;
+    }
+
+    p = parseNumber(skipSpaces(p), halfmoveClock);
+    parseNumber(skipSpaces(p), fullmoveNumber);
+    if (fullmoveNumber < 1) {
+        fullmoveNumber = 1;
+    }
+
+    key = computeKey();
+    return true;
+}
+
+// Zapisuje poziciju kao FEN u out (najmanje MaxFenLength znakova) i vraća dužinu zapisa
+int Board::writeFen(char* out) const {
+    char* p = out;
+    for (int row = 0; row < 8; ++row) {
+        int empty = 0;
+        for (int col = 0; col < 8; ++col) {
+            Color color;
+            PieceType type;
+            if (!pieceAt(makeSquare(row, col), color, type)) {
+                ++empty;
+                continue;
+            }
+            if (empty > 0) {
+                *p++ = (char)('0' + empty);
+                empty = 0;
+            }
+            char c = fenPieceChars[(int)type];
+            *p++ = (color == Color::White) ? (char)(c - 'a' + 'A') : c;
+        }
+        if (empty > 0) {
+            *p++ = (char)('0' + empty);
+        }
+        if (row < 7) {
+            *p++ = '/';
+        }
+    }
+
+    *p++ = ' ';
+    *p++ = (sideToMove == Color::White) ? 'w' : 'b';
+
+    *p++ = ' ';
+    if (castlingRights == 0) *p++ = '-';
+    if (castlingRights & WhiteKingSide) *p++ = 'K';
+    if (castlingRights & WhiteQueenSide) *p++ = 'Q';
+    if (castlingRights & BlackKingSide) *p++ = 'k';
+    if (castlingRights & BlackQueenSide) *p++ = 'q';
+
+    *p++ = ' ';
+    if (enPassantSquare >= 0) {
+        *p++ = (char)('a' + squareColumn(enPassantSquare));
+        *p++ = (char)('8' - squareRow(enPassantSquare));
+    }
+    else {
+        *p++ = '-';
+    }
+
+    *p++ = ' ';
+    p = writeNumber(p, halfmoveClock);
+    *p++ = ' ';
+    p = writeNumber(p, fullmoveNumber);
+    *p = '\0';
+    return (int)(p - out);
+}
+
+std::string Board::getFen() const {
+    char buffer[MaxFenLength];
+    return std::string(buffer, writeFen(buffer));
+}
+
+// Koliko puta se trenutna pozicija već pojavila, najviše maxCount. Ključ prije svakog poteza je
+// sačuvan u istoriji, pa se gleda unazad svaki drugi polupotez (ista strana na potezu), samo do
+// posljednjeg nepovratnog poteza i samo koliko istorija pamti.
+int Board::countRepetitions(int maxCount) const {
+    int limit = halfmoveClock < historyCount ? halfmoveClock : historyCount;
+    int count = 0;
+    for (int back = 4; back <= limit; back += 2) {
+        if (history[(historyTop - back) & (MaxHistory - 1)].key == key && ++count >= maxCount) {
+            break;
+        }
+    }
+    return count;
+}
+
+bool Board::pieceAt(int square, Color& color, PieceType& type) const {
+    Bitboard bit = squareBB(square);
+    if ((occupied & bit) == 0) {
+        return false;
+    }
+
+    color = (occupancy[(int)Color::White] & bit) ? Color::White : Color::Black;
+    for (int t = 0; t < 6; ++t) {
+        if (pieces[(int)color][t] & bit) {
+            type = (PieceType)t;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Da li figure boje byColor napadaju polje. Gleda se unazad od polja: npr. polje napada
+// protivnički skakač ako skakač sa tog polja "vidi" nekog od njih. Staje na prvom napadaču.
+// Zauzetost se može zadati, npr. bez kralja kada se provjerava polje na koje kralj bježi.
+bool Board::isSquareAttacked(int square, Color byColor, Bitboard occupancyMask) const {
+    const Bitboard* enemy = pieces[(int)byColor];
+
+    if (pawnAttacks((int)oppositeColor(byColor), square) & enemy[(int)PieceType::Pawn]) return true;
+    if (knightAttacks(square) & enemy[(int)PieceType::Knight]) return true;
+    if (kingAttacks(square) & enemy[(int)PieceType::King]) return true;
+
+    Bitboard diagonal = enemy[(int)PieceType::Bishop] | enemy[(int)PieceType::Queen];
+    if (diagonal && (bishopAttacks(square, occupancyMask) & diagonal)) return true;
+
+    Bitboard straight = enemy[(int)PieceType::Rook] | enemy[(int)PieceType::Queen];
+    if (straight && (rookAttacks(square, occupancyMask) & straight)) return true;
+
+    return false;
+}
+
+bool Board::isInCheck(Color color) const {
+    int kingSquare = getKingSquare(color);
+    return kingSquare >= 0 && isSquareAttacked(kingSquare, oppositeColor(color));
+}
+
+// Sve figure boje byColor koje napadaju polje
+Bitboard Board::getAttackers(int square, Color byColor) const {
+    const Bitboard* enemy = pieces[(int)byColor];
+
+    return (pawnAttacks((int)oppositeColor(byColor), square) & enemy[(int)PieceType::Pawn])
+        | (knightAttacks(square) & enemy[(int)PieceType::Knight])
+        | (kingAttacks(square) & enemy[(int)PieceType::King])
+        | (bishopAttacks(square, occupied) & (enemy[(int)PieceType::Bishop] | enemy[(int)PieceType::Queen]))
+        | (rookAttacks(square, occupied) & (enemy[(int)PieceType::Rook] | enemy[(int)PieceType::Queen]));
+}
+
+int Board::getKingSquare(Color color) const {
+    Bitboard king = pieces[(int)color][(int)PieceType::King];
+    return king ? lsb(king) : -1;
+}
@@ -0,0 +1,100 @@
+﻿#ifndef BOARD_H
+#define BOARD_H
+
+#include <string>
+#include <cstdint>
+#include "Bitboard.h"
+#include "Piece.h"
+#include "Move.h"
+
+// Početna pozicija u FEN zapisu
+const char* const startFen = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
+// Prava na rokadu, čuvaju se kao bitovi u jednom broju
+enum CastlingRight {
+    WhiteKingSide = 1,
+    WhiteQueenSide = 2,
+    BlackKingSide = 4,
+    BlackQueenSide = 8
+};
+
+// Sve što je potrebno da se potez vrati: koja figura je igrala, šta je uzeto i prethodna prava
+struct UndoRecord {
+    Move move;
+    PieceType movedType;
+    PieceType capturedType;                    // Važi samo kada je move.isCapture()
+    int castlingRights;
+    int enPassantSquare;
+    int halfmoveClock;
+    uint64_t key;                              // Zobrist ključ prije poteza
+};
+
+// Stanje table: 12 bitboarda figura (boja x tip) i maske zauzetosti
+class Board {
+public:
+    static const int MaxHistory = 1024;        // Kapacitet steka za vraćanje poteza (stepen dvojke)
+    static const int MaxFenLength = 100;       // Dovoljno za svaki FEN koji writeFen zapisuje, sa nulom na kraju
+
+private:
+    Bitboard pieces[2][6];                     // Figure po boji i tipu
+    Bitboard occupancy[2];                     // Sva polja koja zauzima bijeli / crni
+    Bitboard occupied;                         // Sva zauzeta polja
+    Color sideToMove;                          // Ko je na potezu
+    int castlingRights;                        // Kombinacija CastlingRight bitova
+    int enPassantSquare;                       // Polje iza pijuna koji je upravo odigrao dva polja, ili -1
+    uint64_t key;                              // Zobrist ključ pozicije, ažurira se uz svaku promjenu
+    int halfmoveClock;                         // Polupotezi od posljednjeg uzimanja ili poteza pijunom
+    int fullmoveNumber;                        // Broj poteza, raste nakon svakog poteza crnog
+    UndoRecord history[MaxHistory];            // Kružni stek odigranih poteza
+    int historyTop;                            // Broj poteza odigranih preko makeMove
+    int historyCount;                          // Koliko poteza se još može vratiti (najviše MaxHistory)
+
+    PieceType typeAt(Color color, int square) const;
+    void togglePiece(Color color, PieceType type, int square);
+
+public:
+    Board();
+
+    void clear();
+    void placePiece(Color color, PieceType type, int square);
+    void removePiece(int square);
+    void makeMove(Move move);
+    bool unmakeMove();
+    int getUndoCount() const { return historyCount; }
+    Move getLastMove() const { return historyCount > 0 ? history[(historyTop - 1) & (MaxHistory - 1)].move : Move(); }  // Move() ako nema poteza
+    bool loadFen(const char* fen);
+    bool loadFen(const std::string& fen) { return loadFen(fen.c_str()); }
+    int writeFen(char* out) const;
+    std::string getFen() const;
+
+    Bitboard getPieces(Color color, PieceType type) const { return pieces[(int)color][(int)type]; }
+    Bitboard getOccupancy(Color color) const { return occupancy[(int)color]; }
+    Bitboard getOccupancy() const { return occupied; }
+
+    bool isEmpty(int square) const { return (occupied & squareBB(square)) == 0; }
+    bool hasPieceOf(Color color, int square) const { return (occupancy[(int)color] & squareBB(square)) != 0; }
+    bool pieceAt(int square, Color& color, PieceType& type) const;
+    int getKingSquare(Color color) const;
+    bool isSquareAttacked(int square, Color byColor) const { return isSquareAttacked(square, byColor, occupied); }
+    bool isSquareAttacked(int square, Color byColor, Bitboard occupancyMask) const;
+    Bitboard getAttackers(int square, Color byColor) const;
+    bool isInCheck(Color color) const;
+
+    Color getSideToMove() const { return sideToMove; }
+    void setSideToMove(Color color);
+    int getCastlingRights() const { return castlingRights; }
+    void setCastlingRights(int rights);
+    int getEnPassantSquare() const { return enPassantSquare; }
+
+    uint64_t getKey() const { return key; }
+    uint64_t computeKey() const;
+
+    // Remi po pravilima: ponavljanje pozicije i pravilo 50 poteza
+    int getHalfmoveClock() const { return halfmoveClock; }
+    int getFullmoveNumber() const { return fullmoveNumber; }
+    bool isFiftyMoveRule() const { return halfmoveClock >= 100; }
+    int countRepetitions(int maxCount) const;
+    bool isDrawByRule() const { return isFiftyMoveRule() || countRepetitions(1) > 0; }
+};
+
+#endif // BOARD_H
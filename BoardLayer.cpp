@@ -0,0 +1,64 @@
+﻿#include "BoardLayer.h"
+#include "GlState.h"
+#include <glad/gl.h>
+#include <iostream>
+
+BoardLayer::BoardLayer() : framebuffer(0), colorTexture(0), width(0), height(0), valid(false), contentKey(0) {}
+
+bool BoardLayer::init(int layerWidth, int layerHeight) {
+    release();
+    width = layerWidth;
+    height = layerHeight;
+
+    glGenTextures(1, &colorTexture);
+    glState.bindTexture(colorTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+    glGenFramebuffers(1, &framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, colorTexture, 0);
+    bool complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    if (!complete) {
+        std::cerr << "Board layer framebuffer is incomplete, drawing the board directly." << std::endl;
+        release();
+        return false;
+    }
+    return true;
+}
+
+void BoardLayer::release() {
+    if (framebuffer != 0) {
+        glDeleteFramebuffers(1, &framebuffer);
+        framebuffer = 0;
+    }
+    if (colorTexture != 0) {
+        glDeleteTextures(1, &colorTexture);
+        colorTexture = 0;
+        glState.reset();                       // Obrisana tekstura je možda bila vezana
+    }
+    valid = false;
+}
+
+void BoardLayer::begin() {
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glViewport(0, 0, width, height);
+    glClearColor(0.2f, 0.2f, 0.2f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+}
+
+void BoardLayer::end(uint32_t key) {
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    contentKey = key;
+    valid = true;
+}
+
+void BoardLayer::blit(int x, int y) const {
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+    glBlitFramebuffer(0, 0, width, height, x, y, x + width, y + height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
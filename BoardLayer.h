@@ -0,0 +1,30 @@
+﻿#ifndef BOARD_LAYER_H
+#define BOARD_LAYER_H
+
+#include <cstdint>
+
+// Statični sloj table (slika table, koordinate, posljednji potez) nacrtan u teksturu van ekrana.
+// Sloj se ponovo crta samo kada se promijeni njegov sadržaj (contentKey), a u svakom kadru se
+// samo kopira u prozor, pa se slika table ne uzorkuje iznova.
+class BoardLayer {
+private:
+    unsigned int framebuffer;
+    unsigned int colorTexture;
+    int width, height;
+    bool valid;                                // Da li tekstura sadrži sloj za contentKey
+    uint32_t contentKey;
+
+public:
+    BoardLayer();
+
+    bool init(int layerWidth, int layerHeight);
+    void release();
+
+    bool needsRender(uint32_t key) const { return !valid || key != contentKey; }
+    void begin();                              // Sve što se crta do end() ide u sloj
+    void end(uint32_t key);
+    void invalidate() { valid = false; }
+    void blit(int x, int y) const;             // Kopira sloj u prozor, donji lijevi ugao na (x, y)
+};
+
+#endif // BOARD_LAYER_H
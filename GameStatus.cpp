@@ -0,0 +1,15 @@
+﻿#include "GameStatus.h"
+#include "MoveGen.h"
+
+GameStatus getGameStatus(const Board& board) {
+    if (!hasLegalMove(board)) {
+        return board.isInCheck(board.getSideToMove()) ? GameStatus::Checkmate : GameStatus::Stalemate;
+    }
+    if (board.isFiftyMoveRule()) {
+        return GameStatus::FiftyMoveRule;
+    }
+    if (board.countRepetitions(2) >= 2) {
+        return GameStatus::ThreefoldRepetition;
+    }
+    return GameStatus::Ongoing;
+}
@@ -0,0 +1,19 @@
+﻿#ifndef GAMESTATUS_H
+#define GAMESTATUS_H
+
+#include "Board.h"
+
+// Stanje partije za stranu koja je na potezu
+enum class GameStatus {
+    Ongoing,
+    Checkmate,                                 // Nema legalnog poteza, a kralj je u šahu
+    Stalemate,                                 // Nema legalnog poteza, a kralj nije u šahu
+    ThreefoldRepetition,                       // Ista pozicija se pojavila treći put
+    FiftyMoveRule                              // 50 poteza bez uzimanja i bez poteza pijunom
+};
+
+// Jednim pozivom razlikuje mat, pat i remi po pravilima; traži samo prvi legalan potez, ne sve.
+// Mat ima prednost nad pravilom 50 poteza.
+GameStatus getGameStatus(const Board& board);
+
+#endif // GAMESTATUS_H
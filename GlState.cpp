@@ -0,0 +1,52 @@
+﻿#include "GlState.h"
+#include <glad/gl.h>
+
+namespace {
+    const unsigned int Unknown = ~0u;
+}
+
+GlState glState;
+
+GlState::GlState() : counters() {
+    reset();
+}
+
+void GlState::useProgram(unsigned int id) {
+    if (id == program) {
+        ++counters.programSkips;
+        return;
+    }
+    glUseProgram(id);
+    program = id;
+    ++counters.programBinds;
+}
+
+void GlState::bindVertexArray(unsigned int id) {
+    if (id == vertexArray) {
+        ++counters.vertexArraySkips;
+        return;
+    }
+    glBindVertexArray(id);
+    vertexArray = id;
+    ++counters.vertexArrayBinds;
+}
+
+void GlState::bindTexture(unsigned int id) {
+    if (id == texture) {
+        ++counters.textureSkips;
+        return;
+    }
+    glBindTexture(GL_TEXTURE_2D, id);
+    texture = id;
+    ++counters.textureBinds;
+}
+
+void GlState::reset() {
+    program = Unknown;
+    vertexArray = Unknown;
+    texture = Unknown;
+}
+
+void GlState::beginFrame() {
+    counters = GlBindCounters();
+}
@@ -0,0 +1,34 @@
+﻿#ifndef GL_STATE_H
+#define GL_STATE_H
+
+// Broj stvarnih i preskočenih vezivanja od početka kadra
+struct GlBindCounters {
+    int programBinds, programSkips;
+    int vertexArrayBinds, vertexArraySkips;
+    int textureBinds, textureSkips;
+};
+
+// Pamti vezani program, VAO i teksturu (jedinica 0) i preskače pozive koji ništa ne bi promijenili.
+// Kod koji crta mora vezivati ove objekte samo preko glState, inače keš ne odgovara stanju OpenGL-a.
+class GlState {
+private:
+    unsigned int program;
+    unsigned int vertexArray;
+    unsigned int texture;
+    GlBindCounters counters;
+
+public:
+    GlState();
+
+    void useProgram(unsigned int id);
+    void bindVertexArray(unsigned int id);
+    void bindTexture(unsigned int id);
+
+    void reset();                              // Stanje je nepoznato, sljedeće vezivanje se uvijek izvršava
+    void beginFrame();
+    const GlBindCounters& getCounters() const { return counters; }
+};
+
+extern GlState glState;
+
+#endif // GL_STATE_H
@@ -0,0 +1,65 @@
+﻿#ifndef MOVE_H
+#define MOVE_H
+
+#include <cstdint>
+#include "Piece.h"
+
+// Vrsta poteza, čuva se u gornja četiri bita. Bit 4 označava uzimanje, bit 8 promociju,
+// a donja dva bita promocije biraju figuru (skakač, lovac, top, kraljica).
+enum MoveFlag {
+    Quiet = 0,
+    DoublePawnPush = 1,
+    KingCastle = 2,
+    QueenCastle = 3,
+    Capture = 4,
+    EnPassant = 5,
+    Promotion = 8,
+    CapturePromotion = 12
+};
+
+// Potez spakovan u 16 bita: bitovi 0-5 polje from, 6-11 polje to, 12-15 MoveFlag
+class Move {
+private:
+    uint16_t data;
+
+public:
+    constexpr Move() : data(0) {}
+    constexpr Move(int from, int to, int flags = Quiet)
+        : data((uint16_t)(from | (to << 6) | (flags << 12))) {}
+
+    constexpr int from() const { return data & 0x3F; }
+    constexpr int to() const { return (data >> 6) & 0x3F; }
+    constexpr int flags() const { return data >> 12; }
+    constexpr uint16_t raw() const { return data; }
+
+    constexpr bool isCapture() const { return (flags() & Capture) != 0; }
+    constexpr bool isPromotion() const { return (flags() & Promotion) != 0; }
+    constexpr bool isEnPassant() const { return flags() == EnPassant; }
+    constexpr bool isCastle() const { return flags() == KingCastle || flags() == QueenCastle; }
+    constexpr bool isDoublePawnPush() const { return flags() == DoublePawnPush; }
+
+    // Figura u koju se pijun pretvara; ima smisla samo kada je isPromotion() tačno
+    constexpr PieceType promotion() const {
+        return (flags() & 3) == 0 ? PieceType::Knight
+            : (flags() & 3) == 1 ? PieceType::Bishop
+            : (flags() & 3) == 2 ? PieceType::Rook
+            : PieceType::Queen;
+    }
+
+    // Flag promocije u zadatu figuru, uz Capture ako se pri tome uzima
+    static constexpr int promotionFlag(PieceType type, bool capture) {
+        return (capture ? CapturePromotion : Promotion) |
+            (type == PieceType::Knight ? 0 : type == PieceType::Bishop ? 1 : type == PieceType::Rook ? 2 : 3);
+    }
+
+    static constexpr Move fromRaw(uint16_t raw) { return Move(raw & 0x3F, (raw >> 6) & 0x3F, raw >> 12); }
+
+    constexpr bool operator==(const Move& other) const { return data == other.data; }
+    constexpr bool operator!=(const Move& other) const { return data != other.data; }
+};
+
+static_assert(sizeof(Move) == 2, "Move mora stati u 16 bita");
+static_assert(Move(52, 36, DoublePawnPush).from() == 52 && Move(52, 36, DoublePawnPush).to() == 36, "Pogrešno pakovanje poteza");
+static_assert(Move(12, 4, Move::promotionFlag(PieceType::Rook, true)).promotion() == PieceType::Rook, "Pogrešno pakovanje promocije");
+
+#endif // MOVE_H
@@ -0,0 +1,236 @@
+﻿#include "MoveGen.h"
+#include "Attacks.h"
+
+namespace {
+
+    // Odredišta koja su protivničke figure dobijaju Capture flag
+    void addMoves(int from, Bitboard targets, Bitboard theirs, MoveList& moves) {
+        Bitboard captures = targets & theirs;
+        Bitboard quiets = targets & ~theirs;
+        while (captures) {
+            moves.add(Move(from, popLsb(captures), Capture));
+        }
+        while (quiets) {
+            moves.add(Move(from, popLsb(quiets), Quiet));
+        }
+    }
+
+    // Smjer, početni red, red promocije i rokada zavise samo od boje, pa su konstante pri kompajliranju
+    template <Color Us>
+    struct SideTraits {
+        static constexpr Color them = oppositeColor(Us);
+        static constexpr int index = (int)Us;
+        static constexpr int forward = (Us == Color::White) ? -8 : 8;
+        static constexpr int left = forward - 1;                             // Uzimanje prema koloni A
+        static constexpr int right = forward + 1;                            // Uzimanje prema koloni H
+        static constexpr int doublePushRow = (Us == Color::White) ? 5 : 2;   // Red nakon prvog koraka sa početnog reda
+        static constexpr int promotionRow = (Us == Color::White) ? 0 : 7;
+        static constexpr int backRow = (Us == Color::White) ? 7 : 0;
+        static constexpr int kingSide = (Us == Color::White) ? WhiteKingSide : BlackKingSide;
+        static constexpr int queenSide = (Us == Color::White) ? WhiteQueenSide : BlackQueenSide;
+    };
+
+    // Generator za stranu Us; za svaku boju se prevodi posebna verzija bez grananja po boji.
+    // Sa AnyMove se vraća čim neka grupa figura da potez, pa lista nije potpuna.
+    template <Color Us, bool AnyMove>
+    MoveList generate(const Board& board) {
+        typedef SideTraits<Us> Side;
+        MoveList moves;
+
+        const Color us = Us;
+        const Color them = Side::them;
+        Bitboard ours = board.getOccupancy(us);
+        Bitboard theirs = board.getOccupancy(them);
+        Bitboard occupied = board.getOccupancy();
+
+        int kingSquare = board.getKingSquare(us);
+        if (kingSquare < 0) {
+            return moves;
+        }
+
+        Bitboard theirStraight = board.getPieces(them, PieceType::Rook) | board.getPieces(them, PieceType::Queen);
+        Bitboard theirDiagonal = board.getPieces(them, PieceType::Bishop) | board.getPieces(them, PieceType::Queen);
+        Bitboard checkers = board.getAttackers(kingSquare, them);
+
+        // Kralj: odredište ne smije biti napadnuto ni kada se kralj skloni sa svog polja
+        Bitboard withoutKing = occupied ^ squareBB(kingSquare);
+        Bitboard kingTargets = kingAttacks(kingSquare) & ~ours;
+        while (kingTargets) {
+            int to = popLsb(kingTargets);
+            if (!board.isSquareAttacked(to, them, withoutKing)) {
+                moves.add(Move(kingSquare, to, (theirs & squareBB(to)) ? Capture : Quiet));
+            }
+        }
+
+        // Kod dvostrukog šaha može da igra samo kralj
+        if ((AnyMove && !moves.empty()) || popCount(checkers) > 1) {
+            return moves;
+        }
+
+        // Kod šaha ostale figure mogu samo da uzmu napadača ili stanu između njega i kralja
+        Bitboard checkMask = checkers ? (checkers | betweenBB(kingSquare, lsb(checkers))) : ~Bitboard(0);
+
+        // Vezane figure: jedina naša figura između kralja i protivničkog topa, lovca ili kraljice
+        Bitboard pinned = 0;
+        Bitboard snipers = (rookAttacks(kingSquare, theirs) & theirStraight) | (bishopAttacks(kingSquare, theirs) & theirDiagonal);
+        while (snipers) {
+            Bitboard blockers = betweenBB(kingSquare, popLsb(snipers)) & occupied;
+            if (blockers && (blockers & (blockers - 1)) == 0 && (blockers & ours)) {
+                pinned |= blockers;
+            }
+        }
+
+        // Vezana figura smije da se kreće samo po liniji veze
+        auto pinMask = [&](int from) {
+            return (pinned & squareBB(from)) ? lineBB(kingSquare, from) : ~Bitboard(0);
+        };
+
+        // Pijuni se generišu skupno: cijeli bitboard se pomjeri, a polazno polje je odredište minus pomak
+        Bitboard pawns = board.getPieces(us, PieceType::Pawn);
+        Bitboard empty = ~occupied;
+        Bitboard promotionRow = rowBB(Side::promotionRow);
+
+        Bitboard singlePushes = shiftBB(pawns, Side::forward) & empty;
+        Bitboard doublePushes = shiftBB(singlePushes & rowBB(Side::doublePushRow), Side::forward) & empty & checkMask;
+        Bitboard leftCaptures = shiftBB(pawns & ~columnBB(0), Side::left) & theirs & checkMask;
+        Bitboard rightCaptures = shiftBB(pawns & ~columnBB(7), Side::right) & theirs & checkMask;
+        singlePushes &= checkMask;
+
+        // Vezani pijun smije samo po liniji veze
+        auto addPawnMoves = [&](Bitboard targets, int offset, MoveFlag flag) {
+            while (targets) {
+                int to = popLsb(targets);
+                int from = to - offset;
+                if (pinMask(from) & squareBB(to)) {
+                    moves.add(Move(from, to, flag));
+                }
+            }
+        };
+
+        // Pijun koji stiže do posljednjeg reda daje četiri poteza, po jedan za svaku promociju
+        auto addPromotions = [&](Bitboard targets, int offset, bool capture) {
+            while (targets) {
+                int to = popLsb(targets);
+                int from = to - offset;
+                if (pinMask(from) & squareBB(to)) {
+                    moves.add(Move(from, to, Move::promotionFlag(PieceType::Queen, capture)));
+                    moves.add(Move(from, to, Move::promotionFlag(PieceType::Rook, capture)));
+                    moves.add(Move(from, to, Move::promotionFlag(PieceType::Bishop, capture)));
+                    moves.add(Move(from, to, Move::promotionFlag(PieceType::Knight, capture)));
+                }
+            }
+        };
+
+        addPawnMoves(singlePushes & ~promotionRow, Side::forward, Quiet);
+        addPawnMoves(doublePushes, 2 * Side::forward, DoublePawnPush);
+        addPawnMoves(leftCaptures & ~promotionRow, Side::left, Capture);
+        addPawnMoves(rightCaptures & ~promotionRow, Side::right, Capture);
+        if ((singlePushes | leftCaptures | rightCaptures) & promotionRow) {
+            addPromotions(singlePushes & promotionRow, Side::forward, false);
+            addPromotions(leftCaptures & promotionRow, Side::left, true);
+            addPromotions(rightCaptures & promotionRow, Side::right, true);
+        }
+
+        // En passant: nakon uzimanja nestaju dva pijuna sa istog reda, pa se legalnost
+        // provjerava ponovnim računanjem napada na kralja sa novom zauzetošću
+        int enPassantSquare = board.getEnPassantSquare();
+        if (enPassantSquare >= 0) {
+            Bitboard capturers = pawns & pawnAttacks((int)them, enPassantSquare);
+            while (capturers) {
+                int from = popLsb(capturers);
+                int capturedSquare = enPassantSquare - Side::forward;
+                Bitboard after = (occupied ^ squareBB(from) ^ squareBB(capturedSquare)) | squareBB(enPassantSquare);
+                Bitboard leaperCheckers = checkers & ~squareBB(capturedSquare) &
+                    (board.getPieces(them, PieceType::Pawn) | board.getPieces(them, PieceType::Knight));
+
+                if (!leaperCheckers &&
+                    !(rookAttacks(kingSquare, after) & theirStraight) &&
+                    !(bishopAttacks(kingSquare, after) & theirDiagonal)) {
+                    moves.add(Move(from, enPassantSquare, EnPassant));
+                }
+            }
+        }
+
+        if (AnyMove && !moves.empty()) {
+            return moves;
+        }
+
+        // Skakači (vezani skakač nikada ne može da se pomjeri)
+        Bitboard knights = board.getPieces(us, PieceType::Knight) & ~pinned;
+        while (knights) {
+            int from = popLsb(knights);
+            addMoves(from, knightAttacks(from) & ~ours & checkMask, theirs, moves);
+        }
+
+        if (AnyMove && !moves.empty()) {
+            return moves;
+        }
+
+        // Lovci, topovi i kraljice
+        Bitboard bishops = board.getPieces(us, PieceType::Bishop) | board.getPieces(us, PieceType::Queen);
+        while (bishops) {
+            int from = popLsb(bishops);
+            addMoves(from, bishopAttacks(from, occupied) & ~ours & checkMask & pinMask(from), theirs, moves);
+        }
+
+        if (AnyMove && !moves.empty()) {
+            return moves;
+        }
+
+        Bitboard rooks = board.getPieces(us, PieceType::Rook) | board.getPieces(us, PieceType::Queen);
+        while (rooks) {
+            int from = popLsb(rooks);
+            addMoves(from, rookAttacks(from, occupied) & ~ours & checkMask & pinMask(from), theirs, moves);
+        }
+
+        // Rokada: kralj nije u šahu, polja između su prazna i kralj ne prelazi preko napadnutog polja.
+        // Kada je rokada legalna, legalan je i korak kralja ka topu, pa je AnyMove ne mora provjeravati.
+        if (!AnyMove && checkers == 0) {
+            const int row = Side::backRow;
+            int rights = board.getCastlingRights();
+            Bitboard ourRooks = board.getPieces(us, PieceType::Rook);
+
+            if (kingSquare == makeSquare(row, 4)) {
+                if ((rights & Side::kingSide) && (ourRooks & squareBB(makeSquare(row, 7))) &&
+                    board.isEmpty(makeSquare(row, 5)) && board.isEmpty(makeSquare(row, 6)) &&
+                    !board.isSquareAttacked(makeSquare(row, 5), them) && !board.isSquareAttacked(makeSquare(row, 6), them)) {
+                    moves.add(Move(kingSquare, makeSquare(row, 6), KingCastle));
+                }
+
+                if ((rights & Side::queenSide) && (ourRooks & squareBB(makeSquare(row, 0))) &&
+                    board.isEmpty(makeSquare(row, 1)) && board.isEmpty(makeSquare(row, 2)) && board.isEmpty(makeSquare(row, 3)) &&
+                    !board.isSquareAttacked(makeSquare(row, 3), them) && !board.isSquareAttacked(makeSquare(row, 2), them)) {
+                    moves.add(Move(kingSquare, makeSquare(row, 2), QueenCastle));
+                }
+            }
+        }
+
+        return moves;
+    }
+}
+
+// Boja se bira jednom, na ulazu; ostatak generatora radi sa konstantama
+MoveList generateLegalMoves(const Board& board) {
+    if (board.getSideToMove() == Color::White) {
+        return generate<Color::White, false>(board);
+    }
+    return generate<Color::Black, false>(board);
+}
+
+bool hasLegalMove(const Board& board) {
+    if (board.getSideToMove() == Color::White) {
+        return !generate<Color::White, true>(board).empty();
+    }
+    return !generate<Color::Black, true>(board).empty();
+}
+
+bool findLegalMove(const Board& board, int from, int to, PieceType promotion, Move& move) {
+    for (Move candidate : generateLegalMoves(board)) {
+        if (candidate.from() == from && candidate.to() == to &&
+            (!candidate.isPromotion() || candidate.promotion() == promotion)) {
+            move = candidate;
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,18 @@
+﻿#ifndef MOVEGEN_H
+#define MOVEGEN_H
+
+#include "Board.h"
+#include "MoveList.h"
+
+// Generiše samo legalne poteze strane koja je na potezu. Šah i vezane figure se računaju
+// jednom po poziciji, pa nije potrebno odigrati svaki potez da bi se provjerila legalnost.
+MoveList generateLegalMoves(const Board& board);
+
+// Da li strana na potezu ima bar jedan legalan potez; staje kod prve grupe figura koja ga ima
+bool hasLegalMove(const Board& board);
+
+// Traži legalni potez sa polja from na polje to. Flagovi (uzimanje, rokada, en passant)
+// se uzimaju iz generatora; promotion bira figuru samo kada je potez promocija.
+bool findLegalMove(const Board& board, int from, int to, PieceType promotion, Move& move);
+
+#endif // MOVEGEN_H
@@ -0,0 +1,30 @@
+﻿#ifndef MOVELIST_H
+#define MOVELIST_H
+
+#include "Move.h"
+
+// Lista poteza sa fiksnim kapacitetom na steku. Nijedna legalna pozicija nema više od
+// 218 poteza, pa 256 mjesta uvijek dovoljno i generisanje ne alocira memoriju.
+class MoveList {
+public:
+    static const int Capacity = 256;
+
+    MoveList() : count(0) {}
+
+    void add(const Move& move) { moves[count++] = move; }
+    void clear() { count = 0; }
+
+    int size() const { return count; }
+    bool empty() const { return count == 0; }
+    const Move& operator[](int index) const { return moves[index]; }
+    Move& operator[](int index) { return moves[index]; }
+
+    const Move* begin() const { return moves; }
+    const Move* end() const { return moves + count; }
+
+private:
+    Move moves[Capacity];
+    int count;
+};
+
+#endif // MOVELIST_H
@@ -0,0 +1,56 @@
+﻿#include "MoveNotation.h"
+#include "MoveGen.h"
+#include <cctype>
+
+namespace {
+
+    // Čita polje na poziciji index, -1 ako tekst ne predstavlja polje
+    int parseSquare(const std::string& text, size_t index) {
+        if (index + 1 >= text.size()) {
+            return -1;
+        }
+        int col = std::tolower((unsigned char)text[index]) - 'a';
+        int row = '8' - text[index + 1];
+        if (col < 0 || col > 7 || row < 0 || row > 7) {
+            return -1;
+        }
+        return makeSquare(row, col);
+    }
+}
+
+std::string squareToNotation(int square) {
+    std::string text;
+    text += (char)('a' + squareColumn(square));
+    text += (char)('8' - squareRow(square));
+    return text;
+}
+
+std::string moveToNotation(Move move) {
+    std::string text = squareToNotation(move.from()) + squareToNotation(move.to());
+    if (move.isPromotion()) {
+        const char promotionChars[] = { 'p', 'r', 'n', 'b', 'q', 'k' };
+        text += promotionChars[(int)move.promotion()];
+    }
+    return text;
+}
+
+bool moveFromNotation(const Board& board, const std::string& text, Move& move) {
+    int from = parseSquare(text, 0);
+    int to = parseSquare(text, 2);
+    if (from < 0 || to < 0) {
+        return false;
+    }
+
+    PieceType promotion = PieceType::Queen;
+    if (text.size() > 4 && !std::isspace((unsigned char)text[4])) {
+        switch (std::tolower((unsigned char)text[4])) {
+        case 'r': promotion = PieceType::Rook; break;
+        case 'n': promotion = PieceType::Knight; break;
+        case 'b': promotion = PieceType::Bishop; break;
+        case 'q': promotion = PieceType::Queen; break;
+        default: return false;
+        }
+    }
+
+    return findLegalMove(board, from, to, promotion, move);
+}
@@ -0,0 +1,22 @@
+﻿#ifndef MOVENOTATION_H
+#define MOVENOTATION_H
+
+#include <string>
+#include "Board.h"
+#include "Move.h"
+
+// Pretvaranje poteza u tekst i nazad. Koristi se samo na granici sa korisnikom
+// (ispis, unos, zapis partije), generator i pretraga rade isključivo sa Move.
+
+// Polje u obliku "e2"
+std::string squareToNotation(int square);
+
+// Potez u obliku "e2e4", promocija sa slovom figure na kraju ("e7e8q")
+std::string moveToNotation(Move move);
+
+// Čita potez u obliku "e2e4" / "E2E4" / "e7e8q" i pronalazi odgovarajući legalni potez.
+// Bez slova promocije podrazumijeva se kraljica, a tekst iza poteza odvojen razmakom se ne čita.
+// Vraća false ako potez nije legalan.
+bool moveFromNotation(const Board& board, const std::string& text, Move& move);
+
+#endif // MOVENOTATION_H
@@ -0,0 +1,346 @@
+﻿// Perft - broji sve legalne pozicije do zadate dubine i mjeri brzinu generatora poteza.
+//
+// Upotreba:
+//   Perft                      pokreće referentne pozicije i provjerava broj čvorova
+//   Perft suite <dubina>       isto, ali najviše do zadate dubine
+//   Perft <dubina> [FEN]       divide: broj čvorova po svakom potezu iz korijena
+//   Perft movegen [ponavljanja] brzina samog generatora i broj alokacija tokom generisanja
+//   Perft bench [dubina] [niti] pretraga do zadate dubine nad referentnim pozicijama, čvorovi u sekundi
+//   Perft smp [dubina] [niti]  skaliranje Lazy SMP pretrage: vrijeme do dubine i čvorovi u sekundi za 1..niti
+//   Perft fen [ponavljanja]    provjera i brzina čitanja i pisanja FEN zapisa
+
+#include "Board.h"
+#include "Piece.h"
+#include "Move.h"
+#include "MoveGen.h"
+#include "MoveNotation.h"
+#include "Search.h"
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <thread>
+
+// Brojač alokacija: svaki poziv globalnog operator new se broji, kako bi se provjerilo
+// da generisanje poteza i perft ne alociraju memoriju
+uint64_t allocationCount = 0;
+
+void* operator new(std::size_t size) {
+    ++allocationCount;
+    if (void* memory = std::malloc(size ? size : 1)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+struct ReferencePosition {
+    const char* name;
+    const char* fen;
+    int defaultDepth;
+    uint64_t expected[6];                      // Očekivani broj čvorova za dubine 1..6 (0 = nije poznato)
+};
+
+// Standardne perft pozicije (https://www.chessprogramming.org/Perft_Results)
+const ReferencePosition referencePositions[] = {
+    { "Initial position", "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", 5,
+        { 20, 400, 8902, 197281, 4865609, 119060324 } },
+    { "Kiwipete", "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1", 4,
+        { 48, 2039, 97862, 4085603, 193690690, 0 } },
+    { "Position 3", "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1", 6,
+        { 14, 191, 2812, 43238, 674624, 11030083 } },
+    { "Position 4", "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1", 5,
+        { 6, 264, 9467, 422333, 15833292, 706045033 } },
+    { "Position 5", "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8", 4,
+        { 44, 1486, 62379, 2103487, 89941194, 0 } },
+    { "Position 6", "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10", 4,
+        { 46, 2079, 89890, 3894594, 164075551, 0 } },
+};
+
+uint64_t perft(Board& board, int depth) {
+    MoveList moves = generateLegalMoves(board);
+    if (depth <= 1) {
+        return depth == 1 ? moves.size() : 1;
+    }
+
+    uint64_t nodes = 0;
+    for (const auto& move : moves) {
+        board.makeMove(move);
+        nodes += perft(board, depth - 1);
+        board.unmakeMove();
+    }
+    return nodes;
+}
+
+double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void printSpeed(uint64_t nodes, double seconds, uint64_t allocations) {
+    std::cout << "Nodes: " << nodes << "\n";
+    std::cout << "Time: " << std::fixed << std::setprecision(3) << seconds << " s\n";
+    std::cout << "Nodes/second: " << (uint64_t)(seconds > 0 ? nodes / seconds : 0) << "\n";
+    std::cout << "Allocations: " << allocations << "\n";
+}
+
+int runDivide(int depth, const std::string& fen) {
+    Board board;
+    if (!board.loadFen(fen)) {
+        std::cerr << "Invalid FEN: " << fen << std::endl;
+        return 1;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    uint64_t allocationsBefore = allocationCount;
+    uint64_t total = 0;
+
+    MoveList moves = generateLegalMoves(board);
+    for (const auto& move : moves) {
+        board.makeMove(move);
+        uint64_t nodes = perft(board, depth - 1);
+        board.unmakeMove();
+        total += nodes;
+        std::cout << moveToNotation(move) << ": " << nodes << "\n";
+    }
+
+    std::cout << "\n";
+    printSpeed(total, secondsSince(start), allocationCount - allocationsBefore);
+    return 0;
+}
+
+int runSuite(int maxDepth) {
+    if (maxDepth > 6) {
+        std::cerr << "Depth must be between 1 and 6." << std::endl;
+        return 1;
+    }
+
+    bool allPassed = true;
+    uint64_t totalNodes = 0;
+    uint64_t totalAllocations = 0;
+    auto suiteStart = std::chrono::steady_clock::now();
+
+    for (const auto& position : referencePositions) {
+        Board board;
+        board.loadFen(position.fen);
+
+        int depth = (maxDepth > 0) ? maxDepth : position.defaultDepth;
+        while (depth > 1 && position.expected[depth - 1] == 0) {
+            --depth;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        uint64_t allocationsBefore = allocationCount;
+        uint64_t nodes = perft(board, depth);
+        double seconds = secondsSince(start);
+        totalNodes += nodes;
+        totalAllocations += allocationCount - allocationsBefore;
+
+        bool passed = nodes == position.expected[depth - 1];
+        allPassed = allPassed && passed;
+
+        std::cout << std::left << std::setw(18) << position.name
+            << " depth " << depth
+            << "  nodes " << std::setw(12) << nodes
+            << " expected " << std::setw(12) << position.expected[depth - 1]
+            << std::fixed << std::setprecision(3) << seconds << " s  "
+            << (passed ? "OK" : "FAIL") << "\n";
+    }
+
+    std::cout << "\n";
+    printSpeed(totalNodes, secondsSince(suiteStart), totalAllocations);
+    std::cout << (allPassed ? "All perft results match." : "Perft mismatch!") << std::endl;
+    return allPassed ? 0 : 1;
+}
+
+// Mjeri samo generisanje poteza: ponavlja generateLegalMoves nad referentnim pozicijama
+// i provjerava da tokom mjerenja nije bilo nijedne alokacije
+int runMoveGenBenchmark(int iterations) {
+    uint64_t totalMoves = 0;
+    uint64_t allocations = 0;
+    double totalSeconds = 0;
+
+    for (const auto& position : referencePositions) {
+        Board board;
+        board.loadFen(position.fen);
+
+        auto start = std::chrono::steady_clock::now();
+        uint64_t allocationsBefore = allocationCount;
+        uint64_t moves = 0;
+        for (int i = 0; i < iterations; ++i) {
+            moves += generateLegalMoves(board).size();
+        }
+        double seconds = secondsSince(start);
+        allocations += allocationCount - allocationsBefore;
+        totalMoves += moves;
+        totalSeconds += seconds;
+
+        std::cout << std::left << std::setw(18) << position.name
+            << " moves " << std::setw(12) << moves
+            << std::fixed << std::setprecision(3) << seconds << " s\n";
+    }
+
+    std::cout << "\n";
+    std::cout << "Generated moves: " << totalMoves << "\n";
+    std::cout << "Moves/second: " << (uint64_t)(totalSeconds > 0 ? totalMoves / totalSeconds : 0) << "\n";
+    std::cout << "Allocations: " << allocations << std::endl;
+    return allocations == 0 ? 0 : 1;
+}
+
+// Svaka referentna pozicija mora se zapisati nazad u isti FEN; zatim se mjeri brzina čitanja
+// i pisanja, bez ijedne alokacije
+int runFenBenchmark(int iterations) {
+    Board board;
+    char buffer[Board::MaxFenLength];
+    bool allPassed = true;
+
+    for (const auto& position : referencePositions) {
+        bool passed = board.loadFen(position.fen);
+        board.writeFen(buffer);
+        passed = passed && std::strcmp(buffer, position.fen) == 0;
+        allPassed = allPassed && passed;
+        std::cout << std::left << std::setw(18) << position.name << (passed ? "OK" : "FAIL") << "\n";
+    }
+
+    const int positionCount = sizeof(referencePositions) / sizeof(referencePositions[0]);
+    uint64_t allocationsBefore = allocationCount;
+    uint64_t checksum = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        board.loadFen(referencePositions[i % positionCount].fen);
+        checksum += board.getKey();
+    }
+    double loadSeconds = secondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        checksum += board.writeFen(buffer);
+    }
+    double writeSeconds = secondsSince(start);
+    uint64_t allocations = allocationCount - allocationsBefore;
+
+    std::cout << "\n";
+    std::cout << "Loads/second: " << (uint64_t)(loadSeconds > 0 ? iterations / loadSeconds : 0) << "\n";
+    std::cout << "Writes/second: " << (uint64_t)(writeSeconds > 0 ? iterations / writeSeconds : 0) << "\n";
+    std::cout << "Allocations: " << allocations << " (checksum " << checksum << ")" << std::endl;
+    return (allPassed && allocations == 0) ? 0 : 1;
+}
+
+// Pretražuje sve referentne pozicije do iste dubine, svaku sa praznom heš tabelom
+uint64_t searchReferencePositions(int depth, int threads, bool verbose) {
+    uint64_t totalNodes = 0;
+
+    for (const auto& position : referencePositions) {
+        Board board;
+        board.loadFen(position.fen);
+
+        Engine engine(threads);
+        SearchLimits limits;
+        limits.maxDepth = depth;
+        SearchResult result = engine.think(board, limits);
+        totalNodes += result.nodes;
+
+        if (!verbose) {
+            continue;
+        }
+
+        std::cout << std::left << std::setw(18) << position.name
+            << " depth " << std::setw(3) << result.depth
+            << " score " << std::setw(7) << result.score
+            << " best " << std::setw(6) << moveToNotation(result.bestMove)
+            << " nodes " << std::setw(12) << result.nodes
+            << std::fixed << std::setprecision(3) << result.seconds << " s\n";
+    }
+
+    return totalNodes;
+}
+
+// Mjeri brzinu pretrage: svaka referentna pozicija se pretražuje do iste dubine
+int runBench(int depth, int threads) {
+    std::cout << "Threads: " << threads << "\n";
+    uint64_t allocationsBefore = allocationCount;
+    auto start = std::chrono::steady_clock::now();
+    uint64_t totalNodes = searchReferencePositions(depth, threads, true);
+
+    std::cout << "\n";
+    printSpeed(totalNodes, secondsSince(start), allocationCount - allocationsBefore);
+    return 0;
+}
+
+// Skaliranje sa brojem niti: vrijeme do zadate dubine i ukupna brzina za 1..maxThreads niti
+int runSmpBenchmark(int depth, int maxThreads) {
+    double baseSeconds = 0;
+
+    std::cout << "Threads  Time to depth " << depth << "  Speedup  Nodes         Nodes/second\n";
+    for (int threads = 1; threads <= maxThreads; ++threads) {
+        auto start = std::chrono::steady_clock::now();
+        uint64_t nodes = searchReferencePositions(depth, threads, false);
+        double seconds = secondsSince(start);
+        if (threads == 1) {
+            baseSeconds = seconds;
+        }
+
+        std::cout << std::left << std::setw(9) << threads
+            << std::fixed << std::setprecision(3) << std::setw(17) << seconds
+            << std::setprecision(2) << std::setw(9) << (seconds > 0 ? baseSeconds / seconds : 0)
+            << std::setw(14) << nodes
+            << (uint64_t)(seconds > 0 ? nodes / seconds : 0) << "\n";
+    }
+    return 0;
+}
+
+int defaultThreads() {
+    unsigned int count = std::thread::hardware_concurrency();
+    return count > 0 ? (int)count : 1;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        return runSuite(0);
+    }
+
+    std::string command = argv[1];
+    if (command == "suite") {
+        return runSuite(argc > 2 ? std::atoi(argv[2]) : 0);
+    }
+    if (command == "bench") {
+        return runBench(argc > 2 ? std::atoi(argv[2]) : 6, argc > 3 ? std::atoi(argv[3]) : 1);
+    }
+    if (command == "smp") {
+        return runSmpBenchmark(argc > 2 ? std::atoi(argv[2]) : 8, argc > 3 ? std::atoi(argv[3]) : defaultThreads());
+    }
+    if (command == "movegen") {
+        return runMoveGenBenchmark(argc > 2 ? std::atoi(argv[2]) : 1000000);
+    }
+    if (command == "fen") {
+        return runFenBenchmark(argc > 2 ? std::atoi(argv[2]) : 1000000);
+    }
+
+    int depth = std::atoi(argv[1]);
+    if (depth < 1 || depth > 6) {
+        std::cerr << "Depth must be between 1 and 6." << std::endl;
+        return 1;
+    }
+
+    std::string fen = startFen;
+    if (argc > 2) {
+        fen.clear();
+        for (int i = 2; i < argc; ++i) {
+            fen += argv[i];
+            fen += ' ';
+        }
+    }
+
+    return runDivide(depth, fen);
+}
@@ -1,72 +1,22 @@
 ﻿#ifndef PIECE_H
 #define PIECE_H
 
-#include <string>
-#include <vector>
-#include <utility>
-#include <memory>
-#include "Position.h"
+#include <cstdint>
 
-enum class PieceType { Pawn, Rook, Knight, Bishop, Queen, King };
-enum class Color { White, Black };
+enum class PieceType : uint8_t { Pawn, Rook, Knight, Bishop, Queen, King };
+enum class Color : uint8_t { White, Black };
 
-class Piece {
-private:
-    std::string name;                          // Naziv figure
-    PieceType type;                            // Tip figure
-    Color color;                               // Boja figure
-    std::vector<Position> possibleMoves;       // Lista mogućih poteza
-    Position currentPosition;                  // Trenutna pozicija figure
-    std::string imagePath;                     // Putanja do slike figure
-    bool hasMoved;                             // Da li se figura pomjerala
-    int pointValue;                            // Vrednost figure u poenima
-    bool isCaptured;
-    bool isBlackKingInCheck;
-    bool isWhiteKingInCheck;
-    bool checkmate;
-
-    void calculatePawnMoves(const std::vector<std::vector<Piece*>>& board, int row, int col);
-    void calculateLinearMoves(const std::vector<std::vector<Piece*>>& board, int row, int col, const std::vector<std::pair<int, int>>& directions);
-    void calculateKingMoves(const std::vector<std::vector<Piece*>>& board, int row, int col);
-    void calculateKnightMoves(const std::vector<std::vector<Piece*>>& board, int row, int col);
-
-public:
-    Piece(const std::string& name, PieceType type, Color color, const Position& initialPosition, const std::string& imagePath, int pointValue)
-        : name(name), type(type), color(color), currentPosition(initialPosition), imagePath(imagePath), hasMoved(false), pointValue(pointValue), isCaptured(false), isBlackKingInCheck(false), isWhiteKingInCheck(false),
-            checkmate(false) {}
-
-    std::string getName() const { return name; }
-    PieceType getType() const { return type; }
-    Color getColor() const { return color; }
-    Position getCurrentPosition() const { return currentPosition; }
-    const std::vector<Position>& getPossibleMoves() const { return possibleMoves; }
-    std::string getImagePath() const { return imagePath; }
-    int getPointValue() const { return pointValue; }
-    bool getIsCaptured() const { return isCaptured; }
-    void printChessboard(const std::vector<std::vector<Piece*>>& board) const;
-    void setPossibleMoves(const std::vector<Position>& moves) {
-        possibleMoves = moves;
-    }
-    void setCurrentPosition(const Position& pos) {
-        currentPosition = pos;
-    }
-
-   
-    bool isAt(int row, int col) const;
-    void setPosition(int row, int col, const std::string& nazivPolja, std::vector<std::vector<Piece*>>& board);
-    void calculatePossibleMoves(const std::vector<std::vector<Piece*>>& board);
-    void capture(std::vector<std::vector<Piece*>>& board);
-    bool isCheckmate(const std::vector<std::unique_ptr<Piece>>& pieces, std::vector<std::vector<Piece*>>& board, Color kingColor);
-    static bool isKingInCheck(const std::vector<std::unique_ptr<Piece>>& pieces, const std::vector<std::vector<Piece*>>& board, Color kingColor);
-    std::vector<Position> filterMovesToAvoidCheck(
-        const std::vector<Position>& possibleMoves,
-        const std::vector<std::unique_ptr<Piece>>& pieces,
-        std::vector<std::vector<Piece*>>& board,
-        Color kingColor
-    );
-
-    void clearPossibleMoves();
+constexpr Color oppositeColor(Color color) { return color == Color::White ? Color::Black : Color::White; }
 
+// Statičke tabele po tipu figure, redoslijed kao u PieceType
+constexpr const char* pieceNames[6] = { "Pawn", "Rook", "Knight", "Bishop", "Queen", "King" };
+constexpr int pieceValues[6] = { 1, 5, 3, 3, 9, 10 };     // Vrijednost u poenima za ocjenu u pretrazi
+constexpr const char* pieceImagePaths[2][6] = {
+    { "res/white_pawn.png", "res/white_rook.png", "res/white_horse.png", "res/white_bishop.png", "res/white_queen.png", "res/white_king.png" },
+    { "res/black_pawn.png", "res/black_rook.png", "res/black_horse.png", "res/black_bishop.png", "res/black_queen.png", "res/black_king.png" }
 };
 
+constexpr const char* pieceName(PieceType type) { return pieceNames[(int)type]; }
+constexpr int pieceValue(PieceType type) { return pieceValues[(int)type]; }
+
 #endif // PIECE_H
@@ -0,0 +1,112 @@
+﻿#include "PieceRenderer.h"
+#include "SquareNdc.h"
+#include "GlState.h"
+#include <glad/gl.h>
+
+PieceRenderer::PieceRenderer()
+    : VAO(0), VBO(0), EBO(0), instanceVBO(0), instanceCount(0), uploadedVersion(0), hasUpload(false) {}
+
+void PieceRenderer::init(const BasicProgram& program, const SpriteAtlas& atlas) {
+    float vertices[] = {
+        // Pozicije      // Teksturne koordinate
+        -0.1f, -0.1f,   0.0f, 0.0f, // Donji levi
+         0.1f, -0.1f,   1.0f, 0.0f, // Donji desni
+         0.1f,  0.1f,   1.0f, 1.0f, // Gornji desni
+        -0.1f,  0.1f,   0.0f, 1.0f  // Gornji levi
+    };
+
+    unsigned int indices[] = {
+        0, 1, 2,
+        2, 3, 0
+    };
+
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &VBO);
+    glGenBuffers(1, &EBO);
+    glGenBuffers(1, &instanceVBO);
+
+    glState.bindVertexArray(VAO);
+
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)(2 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+
+    // Atribut po instanci: dva bajta (polje, slika), napreduje jednom po figuri a ne po verteksu
+    glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+    glBufferData(GL_ARRAY_BUFFER, PieceSet::MaxPieces * 2, nullptr, GL_DYNAMIC_DRAW);
+    glVertexAttribIPointer(2, 2, GL_UNSIGNED_BYTE, 2, (void*)0);
+    glEnableVertexAttribArray(2);
+    glVertexAttribDivisor(2, 1);
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glState.bindVertexArray(0);
+
+    // Slika u atlasu se bira kao boja * 6 + tip
+    float spriteRects[12][4];
+    for (int c = 0; c < 2; ++c) {
+        for (int t = 0; t < 6; ++t) {
+            const SpriteRect& rect = atlas.getRect((PieceType)t, (Color)c);
+            float* target = spriteRects[c * 6 + t];
+            target[0] = rect.u;
+            target[1] = rect.v;
+            target[2] = rect.width;
+            target[3] = rect.height;
+        }
+    }
+
+    glState.useProgram(program.id);
+    glUniform2fv(program.squareCenters, 64, &squareNdcTable.points[0].x);
+    glUniform4fv(program.spriteRects, 12, &spriteRects[0][0]);
+
+    hasUpload = false;
+}
+
+// Bafer instanci se puni samo kada se pozicija (njen ključ) razlikuje od posljednje poslate
+void PieceRenderer::update(const PieceSet& pieces, uint64_t version) {
+    if (hasUpload && version == uploadedVersion) {
+        return;
+    }
+
+    unsigned char instances[PieceSet::MaxPieces][2];
+    instanceCount = 0;
+    for (int piece = 0; piece < pieces.size(); ++piece) {
+        if (pieces.isCaptured(piece)) {
+            continue;
+        }
+        instances[instanceCount][0] = pieces.getSquare(piece);
+        instances[instanceCount][1] = (unsigned char)((int)pieces.getColor(piece) * 6 + (int)pieces.getType(piece));
+        ++instanceCount;
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, instanceCount * 2, instances);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    uploadedVersion = version;
+    hasUpload = true;
+}
+
+void PieceRenderer::draw(const BasicProgram& program, const SpriteAtlas& atlas) const {
+    glState.useProgram(program.id);
+    glUniform1i(program.instanced, 1);
+    glState.bindTexture(atlas.getTexture());
+    glState.bindVertexArray(VAO);
+    glDrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0, instanceCount);
+    glUniform1i(program.instanced, 0);           // Tabla i potezi koriste isti šejder bez instanci
+}
+
+void PieceRenderer::release() {
+    glDeleteVertexArrays(1, &VAO);
+    glDeleteBuffers(1, &VBO);
+    glDeleteBuffers(1, &EBO);
+    glDeleteBuffers(1, &instanceVBO);
+    VAO = VBO = EBO = instanceVBO = 0;
+}
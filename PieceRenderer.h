@@ -0,0 +1,29 @@
+﻿#ifndef PIECE_RENDERER_H
+#define PIECE_RENDERER_H
+
+#include <cstdint>
+#include "PieceSet.h"
+#include "SpriteAtlas.h"
+#include "ShaderProgram.h"
+
+// Crta sve figure jednim glDrawElementsInstanced pozivom. Za svaku figuru na tabli u bafer
+// instanci ide par (polje, slika u atlasu); bafer se puni samo kada se pozicija promijeni.
+// Centri polja i dijelovi atlasa se šalju šejderu kao uniformni nizovi jednom, pri init.
+class PieceRenderer {
+private:
+    unsigned int VAO, VBO, EBO;
+    unsigned int instanceVBO;
+    int instanceCount;
+    uint64_t uploadedVersion;                  // Zobrist ključ pozicije čije su figure u baferu
+    bool hasUpload;
+
+public:
+    PieceRenderer();
+
+    void init(const BasicProgram& program, const SpriteAtlas& atlas);
+    void update(const PieceSet& pieces, uint64_t version);
+    void draw(const BasicProgram& program, const SpriteAtlas& atlas) const;
+    void release();
+};
+
+#endif // PIECE_RENDERER_H
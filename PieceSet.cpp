@@ -0,0 +1,80 @@
+﻿#include "PieceSet.h"
+#include "Board.h"
+
+PieceSet::PieceSet() {
+    clear();
+}
+
+void PieceSet::clear() {
+    count = 0;
+    capturedMask = 0;
+    for (int square = 0; square < 64; ++square) {
+        indexAt[square] = -1;
+    }
+}
+
+// Vraća indeks nove figure, -1 ako je skup pun
+int PieceSet::add(PieceType type, Color color, Square square) {
+    if (count == MaxPieces) {
+        return -1;
+    }
+
+    types[count] = type;
+    colors[count] = color;
+    squares[count] = square;
+    indexAt[square] = (int8_t)count;
+    return count++;
+}
+
+void PieceSet::loadFromBoard(const Board& board) {
+    clear();
+    for (int square = 0; square < 64; ++square) {
+        Color color;
+        PieceType type;
+        if (board.pieceAt(square, color, type)) {
+            add(type, color, (Square)square);
+        }
+    }
+}
+
+// Prati potez koji se igra na tabli: uzimanje, rokada i promocija. Potez mora biti legalan.
+void PieceSet::applyMove(Move move) {
+    int index = indexAt[move.from()];
+    if (index < 0) {
+        return;
+    }
+
+    if (move.isCapture()) {
+        int captureSquare = move.to();
+        if (move.isEnPassant()) {
+            captureSquare += (colors[index] == Color::White) ? 8 : -8;
+        }
+        int victim = indexAt[captureSquare];
+        if (victim >= 0) {
+            capturedMask |= 1u << victim;
+            indexAt[captureSquare] = -1;
+        }
+    }
+
+    moveTo(index, (Square)move.to());
+
+    // Rokada: top preskače kralja
+    if (move.isCastle()) {
+        int row = squareRow(move.from());
+        bool kingSide = move.flags() == KingCastle;
+        int rook = indexAt[makeSquare(row, kingSide ? 7 : 0)];
+        if (rook >= 0) {
+            moveTo(rook, (Square)makeSquare(row, kingSide ? 5 : 3));
+        }
+    }
+
+    if (move.isPromotion()) {
+        types[index] = move.promotion();
+    }
+}
+
+void PieceSet::moveTo(int index, Square target) {
+    indexAt[squares[index]] = -1;
+    squares[index] = target;
+    indexAt[target] = (int8_t)index;
+}
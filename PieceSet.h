@@ -0,0 +1,46 @@
+﻿#ifndef PIECESET_H
+#define PIECESET_H
+
+#include <cstdint>
+#include "Piece.h"
+#include "Square.h"
+#include "Move.h"
+
+class Board;
+
+// Figure na ekranu kao struktura nizova: tip, boja, polje i bit uhvaćenosti za najviše 32 figure.
+// Naziv se čita iz statičke tabele po tipu (Piece.h), a figura na polju se nalazi u O(1) preko
+// indeksa po poljima. Kralja traži Board::getKingSquare iz bitboarda.
+class PieceSet {
+public:
+    static const int MaxPieces = 32;
+
+private:
+    PieceType types[MaxPieces];
+    Color colors[MaxPieces];
+    Square squares[MaxPieces];
+    uint32_t capturedMask;                     // Bit i je postavljen ako je figura i uhvaćena
+    int8_t indexAt[64];                        // Indeks figure na polju, -1 ako je polje prazno
+    int count;
+
+    void moveTo(int index, Square target);
+
+public:
+    PieceSet();
+
+    void clear();
+    int add(PieceType type, Color color, Square square);
+    void loadFromBoard(const Board& board);
+    void applyMove(Move move);
+
+    int size() const { return count; }
+    PieceType getType(int index) const { return types[index]; }
+    Color getColor(int index) const { return colors[index]; }
+    Square getSquare(int index) const { return squares[index]; }
+    bool isCaptured(int index) const { return (capturedMask >> index) & 1; }
+    const char* getName(int index) const { return pieceName(types[index]); }
+
+    int findAt(Square square) const { return indexAt[square]; }
+};
+
+#endif // PIECESET_H
@@ -0,0 +1,341 @@
+﻿#include "Search.h"
+#include "MoveGen.h"
+#include "Piece.h"
+#include <thread>
+#include <vector>
+#include <memory>
+#include <cstring>
+
+namespace {
+
+    // Redoslijed poteza: prvo potez iz heš tabele i prethodne varijante, zatim uzimanja vrijednije
+    // figure manje vrijednom (MVV-LVA) i promocije, pa tihi potezi po istoriji odsjecanja
+    const int TableMoveScore = 2000000;
+    const int PvMoveScore = 1000000;
+    const int CaptureScore = 100000;
+
+    // Ocjena mata se u tabeli čuva u odnosu na trenutni čvor, a ne na korijen
+    int scoreToTable(int score, int ply) {
+        if (score > MateScore - MaxSearchPly) return score + ply;
+        if (score < -MateScore + MaxSearchPly) return score - ply;
+        return score;
+    }
+
+    int scoreFromTable(int score, int ply) {
+        if (score > MateScore - MaxSearchPly) return score - ply;
+        if (score < -MateScore + MaxSearchPly) return score + ply;
+        return score;
+    }
+
+    bool isMateScore(int score) {
+        return score > MateScore - MaxSearchPly || score < -MateScore + MaxSearchPly;
+    }
+}
+
+int evaluate(const Board& board) {
+    int score = 0;
+    for (int t = 0; t < 5; ++t) {
+        PieceType type = (PieceType)t;
+        int value = pieceValue(type) * 100;
+        score += value * (popCount(board.getPieces(Color::White, type)) - popCount(board.getPieces(Color::Black, type)));
+    }
+    return board.getSideToMove() == Color::White ? score : -score;
+}
+
+Search::Search(TranspositionTable& table, std::atomic<bool>& stopSignal, int threadIndex)
+    : table(table), stopSignal(stopSignal), threadIndex(threadIndex), nodes(0), stopped(false), previousPvLength(0) {
+    std::memset(history, 0, sizeof(history));
+}
+
+SearchResult Search::think(Board& board, const SearchLimits& searchLimits) {
+    limits = searchLimits;
+    nodes = 0;
+    stopped = false;
+    previousPvLength = 0;
+    start = std::chrono::steady_clock::now();
+
+    SearchResult result;
+    MoveList rootMoves = generateLegalMoves(board);
+    if (rootMoves.empty()) {
+        return result;
+    }
+    result.bestMove = rootMoves[0];
+    result.pv[0] = rootMoves[0];
+    result.pvLength = 1;
+
+    // Pomoćne niti sa neparnim indeksom počinju jednu dubinu dublje od glavne
+    int maxDepth = limits.maxDepth < MaxSearchPly - 1 ? limits.maxDepth : MaxSearchPly - 1;
+    for (int depth = 1 + (threadIndex & 1); depth <= maxDepth; ++depth) {
+        int score = negamax(board, depth, 0, -InfiniteScore, InfiniteScore);
+
+        // Prekinuta iteracija se odbacuje, važi rezultat prethodne
+        if (stopped) {
+            break;
+        }
+
+        result.score = score;
+        result.depth = depth;
+        result.pvLength = pvLength[0];
+        for (int i = 0; i < pvLength[0]; ++i) {
+            result.pv[i] = pvTable[0][i];
+            previousPv[i] = pvTable[0][i];
+        }
+        previousPvLength = pvLength[0];
+        result.bestMove = result.pv[0];
+
+        // Pronađen mat, dublja pretraga ne može dati bolji potez
+        if (isMateScore(score)) {
+            break;
+        }
+    }
+
+    result.nodes = nodes;
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+int Search::negamax(Board& board, int depth, int ply, int alpha, int beta) {
+    pvLength[ply] = 0;
+
+    if (depth <= 0 || ply >= MaxSearchPly - 1) {
+        return quiescence(board, ply, alpha, beta);
+    }
+
+    ++nodes;
+    if (outOfBudget()) {
+        return 0;
+    }
+
+    // Unutar pretrage je već prvo ponavljanje remi: ako vodi ka dobitku, postoji i bolji put
+    if (ply > 0 && board.isDrawByRule()) {
+        return 0;
+    }
+
+    // Rezultat iste pozicije iz heš tabele; u korijenu se uvijek pretražuje da bi se dobila varijanta
+    uint64_t key = board.getKey();
+    TTEntry entry;
+    Move tableMove;
+    if (table.probe(key, entry)) {
+        tableMove = entry.move;
+        int tableScore = scoreFromTable(entry.score, ply);
+        if (ply > 0 && entry.depth >= depth &&
+            (entry.bound == BoundExact ||
+                (entry.bound == BoundLower && tableScore >= beta) ||
+                (entry.bound == BoundUpper && tableScore <= alpha))) {
+            return tableScore;
+        }
+    }
+
+    MoveList moves = generateLegalMoves(board);
+    if (moves.empty()) {
+        // Mat ili pat
+        return board.isInCheck(board.getSideToMove()) ? -MateScore + ply : 0;
+    }
+
+    orderMoves(board, moves, ply, tableMove);
+
+    int originalAlpha = alpha;
+    Move bestMove;
+    int side = (int)board.getSideToMove();
+
+    for (Move move : moves) {
+        board.makeMove(move);
+        int score = -negamax(board, depth - 1, ply + 1, -beta, -alpha);
+        board.unmakeMove();
+
+        if (stopped) {
+            return 0;
+        }
+
+        if (score > alpha) {
+            alpha = score;
+            bestMove = move;
+
+            // Nova najbolja varijanta: ovaj potez pa varijanta iz dubljeg nivoa
+            pvTable[ply][0] = move;
+            for (int i = 0; i < pvLength[ply + 1]; ++i) {
+                pvTable[ply][i + 1] = pvTable[ply + 1][i];
+            }
+            pvLength[ply] = pvLength[ply + 1] + 1;
+
+            if (alpha >= beta) {
+                if (!move.isCapture() && !move.isPromotion()) {
+                    history[side][move.from()][move.to()] += depth * depth;
+                }
+                break;
+            }
+        }
+    }
+
+    Bound bound = alpha >= beta ? BoundLower : (alpha > originalAlpha ? BoundExact : BoundUpper);
+    table.store(key, bestMove, scoreToTable(alpha, ply), depth, bound);
+    return alpha;
+}
+
+// Mirna pretraga: na kraju dubine igraju se samo uzimanja i promocije, kako se ocjena
+// ne bi računala usred razmjene figura
+int Search::quiescence(Board& board, int ply, int alpha, int beta) {
+    pvLength[ply] = 0;
+
+    ++nodes;
+    if (outOfBudget()) {
+        return 0;
+    }
+
+    int standPat = evaluate(board);
+    if (standPat >= beta || ply >= MaxSearchPly - 1) {
+        return standPat;
+    }
+    if (standPat > alpha) {
+        alpha = standPat;
+    }
+
+    MoveList moves = generateLegalMoves(board);
+    orderMoves(board, moves, ply, Move());
+
+    for (Move move : moves) {
+        if (!move.isCapture() && !move.isPromotion()) {
+            continue;
+        }
+
+        board.makeMove(move);
+        int score = -quiescence(board, ply + 1, -beta, -alpha);
+        board.unmakeMove();
+
+        if (stopped) {
+            return 0;
+        }
+
+        if (score > alpha) {
+            alpha = score;
+            if (alpha >= beta) {
+                break;
+            }
+        }
+    }
+
+    return alpha;
+}
+
+void Search::orderMoves(const Board& board, MoveList& moves, int ply, Move tableMove) const {
+    int scores[MoveList::Capacity];
+    int side = (int)board.getSideToMove();
+    for (int i = 0; i < moves.size(); ++i) {
+        Move move = moves[i];
+        int score = 0;
+
+        if (move == tableMove) {
+            score = TableMoveScore;
+        }
+        else if (ply < previousPvLength && move == previousPv[ply]) {
+            score = PvMoveScore;
+        }
+        else if (move.isCapture() || move.isPromotion()) {
+            Color color;
+            PieceType attacker = PieceType::Pawn;
+            PieceType victim = PieceType::Pawn;
+            board.pieceAt(move.from(), color, attacker);
+            if (move.isCapture() && !move.isEnPassant()) {
+                board.pieceAt(move.to(), color, victim);
+            }
+            score = CaptureScore + pieceValue(victim) * 10 - pieceValue(attacker);
+            if (move.isPromotion()) {
+                score += pieceValue(move.promotion()) * 10;
+            }
+        }
+        else {
+            int value = history[side][move.from()][move.to()];
+            score = value < CaptureScore - 1 ? value : CaptureScore - 1;
+        }
+        scores[i] = score;
+    }
+
+    // Sortiranje umetanjem, liste su kratke
+    for (int i = 1; i < moves.size(); ++i) {
+        Move move = moves[i];
+        int score = scores[i];
+        int j = i - 1;
+        while (j >= 0 && scores[j] < score) {
+            moves[j + 1] = moves[j];
+            scores[j + 1] = scores[j];
+            --j;
+        }
+        moves[j + 1] = move;
+        scores[j + 1] = score;
+    }
+}
+
+// Signal i sat se provjeravaju na svakih 1024 čvora, sat je skuplji od samog čvora.
+// Samo glavna nit troši budžet; kada ga potroši, zaustavlja i pomoćne niti.
+bool Search::outOfBudget() {
+    if (stopped) {
+        return true;
+    }
+    if ((nodes & 1023) != 0) {
+        return false;
+    }
+
+    if (threadIndex == 0) {
+        if ((limits.maxNodes && nodes >= limits.maxNodes) ||
+            (limits.maxSeconds > 0 &&
+                std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() >= limits.maxSeconds)) {
+            stopSignal.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    stopped = stopSignal.load(std::memory_order_relaxed);
+    return stopped;
+}
+
+Engine::Engine(int threads, int hashMegabytes) : table(hashMegabytes), threads(1), stopSignal(false) {
+    setThreads(threads);
+}
+
+void Engine::setThreads(int count) {
+    threads = count < 1 ? 1 : (count > MaxSearchThreads ? MaxSearchThreads : count);
+}
+
+SearchResult Engine::think(const Board& board, const SearchLimits& limits) {
+    stopSignal.store(false, std::memory_order_relaxed);
+
+    // Svaka nit ima svoju kopiju table i svoju istoriju; dijeli se samo heš tabela
+    std::vector<std::unique_ptr<Search>> searches;
+    std::vector<std::unique_ptr<Board>> boards;
+    for (int i = 0; i < threads; ++i) {
+        searches.emplace_back(new Search(table, stopSignal, i));
+        boards.emplace_back(new Board(board));
+    }
+
+    // Pomoćne niti nemaju sopstveni budžet, rade dok ih glavna nit ne zaustavi
+    SearchLimits helperLimits = limits;
+    helperLimits.maxNodes = 0;
+    helperLimits.maxSeconds = 0;
+
+    std::vector<SearchResult> results(threads);
+    std::vector<std::thread> helpers;
+    for (int i = 1; i < threads; ++i) {
+        helpers.emplace_back([&, i]() {
+            results[i] = searches[i]->think(*boards[i], helperLimits);
+        });
+    }
+
+    results[0] = searches[0]->think(*boards[0], limits);
+    stopSignal.store(true, std::memory_order_relaxed);
+    for (auto& helper : helpers) {
+        helper.join();
+    }
+
+    // Rezultat glavne niti, osim ako je neka pomoćna nit završila dublju iteraciju
+    SearchResult best = results[0];
+    uint64_t totalNodes = 0;
+    for (int i = 0; i < threads; ++i) {
+        totalNodes += searches[i]->getNodes();
+        if (i > 0 && results[i].pvLength > 0 && results[i].depth > best.depth) {
+            best = results[i];
+        }
+    }
+
+    best.nodes = totalNodes;
+    best.seconds = results[0].seconds;
+    return best;
+}
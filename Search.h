@@ -0,0 +1,93 @@
+﻿#ifndef SEARCH_H
+#define SEARCH_H
+
+#include <atomic>
+#include <cstdint>
+#include <chrono>
+#include "Board.h"
+#include "MoveList.h"
+#include "TranspositionTable.h"
+
+const int MaxSearchPly = 64;                   // Najveća dubina od korijena, uključujući mirnu pretragu
+const int MateScore = 30000;                   // Ocjena mata u korijenu, umanjena za broj poteza do mata
+const int InfiniteScore = 32000;
+const int MaxSearchThreads = 64;
+
+// Ograničenja pretrage; 0 znači da ograničenja nema
+struct SearchLimits {
+    int maxDepth;
+    uint64_t maxNodes;                         // Broji se samo u glavnoj niti
+    double maxSeconds;
+
+    SearchLimits() : maxDepth(MaxSearchPly - 1), maxNodes(0), maxSeconds(0) {}
+};
+
+// Rezultat posljednje završene iteracije
+struct SearchResult {
+    Move bestMove;
+    int score;                                 // U stotim dijelovima pijuna, iz ugla strane na potezu
+    int depth;
+    uint64_t nodes;                            // Svi čvorovi svih niti, uključujući nezavršenu iteraciju
+    double seconds;
+    Move pv[MaxSearchPly];                     // Glavna varijanta, pv[0] == bestMove; prazna ako nema legalnih poteza
+    int pvLength;
+
+    SearchResult() : score(0), depth(0), nodes(0), seconds(0), pvLength(0) {}
+};
+
+// Ocjena pozicije iz ugla strane na potezu: razlika materijala po pieceValue (Piece.h)
+int evaluate(const Board& board);
+
+// Jedna nit pretrage: negamax alfa-beta sa iterativnim produbljivanjem. Igra za stranu koja je
+// na potezu, pa se može koristiti i za bijelog i za crnog. Tabla se vraća u početno stanje.
+// Glavna nit (threadIndex 0) mjeri vrijeme i čvorove i podiže stopSignal, pomoćne niti ga samo čitaju.
+class Search {
+private:
+    TranspositionTable& table;
+    std::atomic<bool>& stopSignal;
+    int threadIndex;
+    SearchLimits limits;
+    uint64_t nodes;
+    bool stopped;
+    std::chrono::steady_clock::time_point start;
+    Move pvTable[MaxSearchPly][MaxSearchPly];  // Trokutasta tabela glavne varijante
+    int pvLength[MaxSearchPly];
+    Move previousPv[MaxSearchPly];             // Varijanta prethodne iteracije, igra se prva
+    int previousPvLength;
+    int history[2][64][64];                    // Tihi potezi koji su doveli do odsjecanja, po boji i poljima
+
+    int negamax(Board& board, int depth, int ply, int alpha, int beta);
+    int quiescence(Board& board, int ply, int alpha, int beta);
+    void orderMoves(const Board& board, MoveList& moves, int ply, Move tableMove) const;
+    bool outOfBudget();
+
+public:
+    Search(TranspositionTable& table, std::atomic<bool>& stopSignal, int threadIndex = 0);
+
+    SearchResult think(Board& board, const SearchLimits& searchLimits);
+    uint64_t getNodes() const { return nodes; }
+};
+
+// Lazy SMP: sve niti pretražuju istu poziciju i dijele heš tabelu, pa pomoćne niti popunjavaju
+// tabelu rezultatima koje glavna nit zatim koristi. Pomoćne niti počinju na različitim dubinama
+// kako ne bi sve radile isti posao. Glavna nit (pozivalac) upravlja vremenom i bira rezultat.
+// think se može pozvati iz posebne niti, a stop() iz bilo koje niti je prekida što prije.
+class Engine {
+private:
+    TranspositionTable table;
+    int threads;
+    std::atomic<bool> stopSignal;              // Zajednički za sve niti jedne pretrage, think ga spušta na početku
+
+public:
+    explicit Engine(int threads = 1, int hashMegabytes = 16);
+
+    void setThreads(int count);
+    int getThreads() const { return threads; }
+    void setHashSize(int megabytes) { table.resize(megabytes); }
+    void newGame() { table.clear(); }
+    void stop() { stopSignal.store(true, std::memory_order_relaxed); }
+
+    SearchResult think(const Board& board, const SearchLimits& limits);
+};
+
+#endif // SEARCH_H
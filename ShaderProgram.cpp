@@ -0,0 +1,17 @@
+﻿#include "ShaderProgram.h"
+#include <glad/gl.h>
+
+BasicProgram::BasicProgram(unsigned int id)
+    : id(id),
+    model(glGetUniformLocation(id, "model")),
+    spriteRect(glGetUniformLocation(id, "spriteRect")),
+    moveColor(glGetUniformLocation(id, "moveColor")),
+    solidColor(glGetUniformLocation(id, "solidColor")),
+    instanced(glGetUniformLocation(id, "instanced")),
+    squareCenters(glGetUniformLocation(id, "squareCenters")),
+    spriteRects(glGetUniformLocation(id, "spriteRects")) {}
+
+TextProgram::TextProgram(unsigned int id)
+    : id(id),
+    projection(glGetUniformLocation(id, "projection")),
+    textColor(glGetUniformLocation(id, "textColor")) {}
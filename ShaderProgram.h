@@ -0,0 +1,30 @@
+﻿#ifndef SHADER_PROGRAM_H
+#define SHADER_PROGRAM_H
+
+// Šejder programi sa lokacijama uniformi koje se traže samo jednom, odmah nakon linkovanja,
+// pa se pri crtanju ne poziva glGetUniformLocation
+
+// basic.vert + basic.frag: tabla, figure i mogući potezi
+struct BasicProgram {
+    unsigned int id;
+    int model;
+    int spriteRect;
+    int moveColor;
+    int solidColor;
+    int instanced;
+    int squareCenters;
+    int spriteRects;
+
+    explicit BasicProgram(unsigned int id);
+};
+
+// text.vert + text.frag
+struct TextProgram {
+    unsigned int id;
+    int projection;
+    int textColor;
+
+    explicit TextProgram(unsigned int id);
+};
+
+#endif // SHADER_PROGRAM_H
@@ -0,0 +1,92 @@
+﻿#include "SpriteAtlas.h"
+#include "stb_image.h"
+#include <glad/gl.h>
+#include "GlState.h"
+#include <iostream>
+#include <vector>
+
+SpriteAtlas::SpriteAtlas() : texture(0), rects() {}
+
+SpriteAtlas::~SpriteAtlas() {
+    release();
+}
+
+// Dekodira slike, računa raspored i jednom šalje cijeli atlas na GPU
+bool SpriteAtlas::load() {
+    release();
+
+    struct Image {
+        unsigned char* data;
+        int width, height;
+        int x, y;
+    };
+    Image images[2][6] = {};
+
+    stbi_set_flip_vertically_on_load(true);
+    bool loaded = true;
+    int atlasWidth = 0;
+    int atlasHeight = 0;
+
+    // Bijele figure u donjem redu, crne iznad njih; širina atlasa je širi od dva reda
+    for (int c = 0; c < 2 && loaded; ++c) {
+        int x = Padding;
+        int rowHeight = 0;
+        for (int t = 0; t < 6; ++t) {
+            Image& image = images[c][t];
+            const char* path = pieceImagePaths[c][t];
+            int channels;
+            image.data = stbi_load(path, &image.width, &image.height, &channels, 4);
+            if (!image.data) {
+                std::cerr << "Failed to load texture: " << path << std::endl;
+                loaded = false;
+                break;
+            }
+            image.x = x;
+            image.y = atlasHeight + Padding;
+            x += image.width + Padding;
+            rowHeight = image.height > rowHeight ? image.height : rowHeight;
+        }
+        atlasWidth = x > atlasWidth ? x : atlasWidth;
+        atlasHeight += rowHeight + Padding;
+    }
+    atlasHeight += Padding;
+
+    if (loaded) {
+        // Prazan (providan) atlas, pa se slike upisuju na svoja mjesta
+        std::vector<unsigned char> blank((size_t)atlasWidth * atlasHeight * 4, 0);
+
+        glGenTextures(1, &texture);
+        glState.bindTexture(texture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, atlasWidth, atlasHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, blank.data());
+
+        for (int c = 0; c < 2; ++c) {
+            for (int t = 0; t < 6; ++t) {
+                const Image& image = images[c][t];
+                glTexSubImage2D(GL_TEXTURE_2D, 0, image.x, image.y, image.width, image.height, GL_RGBA, GL_UNSIGNED_BYTE, image.data);
+                rects[c][t] = {
+                    (float)image.x / atlasWidth, (float)image.y / atlasHeight,
+                    (float)image.width / atlasWidth, (float)image.height / atlasHeight
+                };
+            }
+        }
+    }
+
+    for (int c = 0; c < 2; ++c) {
+        for (int t = 0; t < 6; ++t) {
+            stbi_image_free(images[c][t].data);
+        }
+    }
+    return loaded;
+}
+
+void SpriteAtlas::release() {
+    if (texture != 0) {
+        glDeleteTextures(1, &texture);
+        texture = 0;
+    }
+}
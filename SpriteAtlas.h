@@ -0,0 +1,36 @@
+﻿#ifndef SPRITE_ATLAS_H
+#define SPRITE_ATLAS_H
+
+#include "Piece.h"
+
+// Dio atlasa u kome je jedna slika: pomak i veličina u teksturnim koordinatama (0..1)
+struct SpriteRect {
+    float u, v;
+    float width, height;
+};
+
+// Svih 12 slika figura iz res/ se učitava jednom, pri pokretanju, u jednu teksturu.
+// Slike se slažu u dva reda (bijele, pa crne) sa razmakom, pa se pri crtanju samo bira dio teksture.
+class SpriteAtlas {
+public:
+    static const int Padding = 2;              // Prazni pikseli između slika, da se susjedne ne miješaju pri filtriranju
+
+private:
+    unsigned int texture;
+    SpriteRect rects[2][6];                    // Po boji i tipu figure, redoslijed kao u Piece.h
+
+public:
+    SpriteAtlas();
+    ~SpriteAtlas();
+
+    SpriteAtlas(const SpriteAtlas&) = delete;
+    SpriteAtlas& operator=(const SpriteAtlas&) = delete;
+
+    bool load();
+    void release();
+
+    unsigned int getTexture() const { return texture; }
+    const SpriteRect& getRect(PieceType type, Color color) const { return rects[(int)color][(int)type]; }
+};
+
+#endif // SPRITE_ATLAS_H
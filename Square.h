@@ -0,0 +1,12 @@
+﻿#ifndef SQUARE_H
+#define SQUARE_H
+
+#include <cstdint>
+
+// Polje table u jednom bajtu: red * 8 + kolona, A8 = 0, H1 = 63 (vidi makeSquare u Bitboard.h).
+// Koordinate za crtanje se ne čuvaju uz polje, računaju se tek pri crtanju (SquareNdc.h).
+typedef uint8_t Square;
+
+const Square NoSquare = 64;
+
+#endif // SQUARE_H
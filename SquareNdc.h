@@ -0,0 +1,33 @@
+﻿#ifndef SQUARENDC_H
+#define SQUARENDC_H
+
+#include "Square.h"
+
+// Centar polja u OpenGL koordinatama (-1 do 1) kada tabla zauzima cijeli viewport
+struct NdcPoint {
+    float x;
+    float y;
+};
+
+struct SquareNdcTable {
+    NdcPoint points[64];
+};
+
+// Tabela se računa pri kompajliranju; red 0 (osmi red) je na vrhu table
+constexpr SquareNdcTable makeSquareNdcTable() {
+    SquareNdcTable table{};
+    for (int square = 0; square < 64; ++square) {
+        table.points[square].x = -0.875f + (square % 8) * 0.25f;
+        table.points[square].y = 0.875f - (square / 8) * 0.25f;
+    }
+    return table;
+}
+
+constexpr SquareNdcTable squareNdcTable = makeSquareNdcTable();
+
+constexpr NdcPoint squareToNdc(Square square) { return squareNdcTable.points[square]; }
+
+static_assert(squareToNdc(0).x == -0.875f && squareToNdc(0).y == 0.875f, "A8 mora biti gore lijevo");
+static_assert(squareToNdc(63).x == 0.875f && squareToNdc(63).y == -0.875f, "H1 mora biti dolje desno");
+
+#endif // SQUARENDC_H
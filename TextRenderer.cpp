@@ -1,10 +1,12 @@
 ﻿#include "TextRenderer.h"
 #include <iostream>
 #include <glad/gl.h>
+#include "GlState.h"
 #include <glm/gtc/type_ptr.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 
-TextRenderer::TextRenderer(unsigned int width, unsigned int height) {
+TextRenderer::TextRenderer(unsigned int width, unsigned int height)
+    : Characters(), AtlasTexture(0), VAO(0), VBO(0), BufferCapacity(0) {
     initRenderData();
 }
 
@@ -13,24 +15,24 @@ void TextRenderer::initRenderData() {
     glGenVertexArrays(1, &VAO);
     glGenBuffers(1, &VBO);
 
-    glBindVertexArray(VAO);
+    glState.bindVertexArray(VAO);
     glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(float) * 6 * 4, NULL, GL_DYNAMIC_DRAW);
 
     glEnableVertexAttribArray(0);
     glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
 
     glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+    glState.bindVertexArray(0);
 }
 
-void TextRenderer::setProjection(unsigned int shader, unsigned int width, unsigned int height) {
+void TextRenderer::setProjection(const TextProgram& program, unsigned int width, unsigned int height) {
     glm::mat4 projection = glm::ortho(0.0f, static_cast<float>(width), 0.0f, static_cast<float>(height));
-    glUseProgram(shader);
-    glUniformMatrix4fv(glGetUniformLocation(shader, "projection"), 1, GL_FALSE, glm::value_ptr(projection));
+    glState.useProgram(program.id);
+    glUniformMatrix4fv(program.projection, 1, GL_FALSE, glm::value_ptr(projection));
 }
 
 
+// Glifi se slažu u redove atlasa širine AtlasWidth; atlas se šalje na GPU jednim glTexImage2D
 void TextRenderer::loadFont(const char* fontPath) {
     FT_Library ft;
     if (FT_Init_FreeType(&ft)) {
@@ -45,7 +47,15 @@ void TextRenderer::loadFont(const char* fontPath) {
     }
 
     FT_Set_Pixel_Sizes(face, 0, 48);
-    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    struct Placement {
+        int x, y;
+    };
+    std::array<Placement, 128> placements = {};
+    std::vector<unsigned char> pixels;
+    int penX = GlyphPadding;
+    int penY = GlyphPadding;
+    int rowHeight = 0;
 
     for (unsigned char c = 0; c < 128; c++) {
         if (FT_Load_Char(face, c, FT_LOAD_RENDER)) {
@@ -53,49 +63,73 @@ void TextRenderer::loadFont(const char* fontPath) {
             continue;
         }
 
-        unsigned int texture;
-        glGenTextures(1, &texture);
-        glBindTexture(GL_TEXTURE_2D, texture);
-        glTexImage2D(
-            GL_TEXTURE_2D,
-            0,
-            GL_RED,
-            face->glyph->bitmap.width,
-            face->glyph->bitmap.rows,
-            0,
-            GL_RED,
-            GL_UNSIGNED_BYTE,
-            face->glyph->bitmap.buffer
-        );
-
-
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-        Character character = {
-            texture,
-            glm::ivec2(face->glyph->bitmap.width, face->glyph->bitmap.rows),
+        const FT_Bitmap& bitmap = face->glyph->bitmap;
+        int width = (int)bitmap.width;
+        int rows = (int)bitmap.rows;
+
+        if (penX + width + GlyphPadding > AtlasWidth) {
+            penX = GlyphPadding;
+            penY += rowHeight + GlyphPadding;
+            rowHeight = 0;
+        }
+        if (pixels.size() < (size_t)(penY + rows + GlyphPadding) * AtlasWidth) {
+            pixels.resize((size_t)(penY + rows + GlyphPadding) * AtlasWidth, 0);
+        }
+
+        for (int row = 0; row < rows; ++row) {
+            for (int col = 0; col < width; ++col) {
+                pixels[(size_t)(penY + row) * AtlasWidth + penX + col] = bitmap.buffer[row * bitmap.pitch + col];
+            }
+        }
+
+        placements[c] = { penX, penY };
+        Characters[c] = {
+            glm::vec2(0.0f),
+            glm::vec2(0.0f),
+            glm::ivec2(width, rows),
             glm::ivec2(face->glyph->bitmap_left, face->glyph->bitmap_top),
             (unsigned int)face->glyph->advance.x
         };
-        Characters.insert(std::pair<char, Character>(c, character));
+
+        penX += width + GlyphPadding;
+        rowHeight = rows > rowHeight ? rows : rowHeight;
+    }
+
+    // UV koordinate se računaju tek kada je poznata konačna visina atlasa
+    int atlasHeight = (int)(pixels.size() / AtlasWidth);
+    for (int c = 0; c < 128; ++c) {
+        Character& ch = Characters[c];
+        ch.UvMin = glm::vec2((float)placements[c].x / AtlasWidth, (float)placements[c].y / atlasHeight);
+        ch.UvMax = glm::vec2((float)(placements[c].x + ch.Size.x) / AtlasWidth, (float)(placements[c].y + ch.Size.y) / atlasHeight);
     }
 
+    if (AtlasTexture == 0) {
+        glGenTextures(1, &AtlasTexture);
+    }
+    glState.bindTexture(AtlasTexture);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, AtlasWidth, atlasHeight, 0, GL_RED, GL_UNSIGNED_BYTE, pixels.data());
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
     FT_Done_Face(face);
     FT_Done_FreeType(ft);
 }
 
 
-void TextRenderer::renderText(unsigned int shader, const std::string& text, float x, float y, float scale, glm::vec3 color) {
-    glUseProgram(shader);
-    glUniform3f(glGetUniformLocation(shader, "textColor"), color.x, color.y, color.z);
-    glActiveTexture(GL_TEXTURE0);
-    glBindVertexArray(VAO);
+// Četvorouglovi svih slova se skupljaju u jedan bafer i crtaju jednim glDrawArrays
+void TextRenderer::renderText(const TextProgram& program, const std::string& text, float x, float y, float scale, glm::vec3 color) {
+    Vertices.clear();
 
     for (auto c = text.begin(); c != text.end(); c++) {
-        Character ch = Characters[*c];
+        unsigned char code = (unsigned char)*c;
+        if (code >= Characters.size()) {
+            continue;
+        }
+        const Character& ch = Characters[code];
 
         float xpos = x + ch.Bearing.x * scale;
         float ypos = y - (ch.Size.y - ch.Bearing.y) * scale;
@@ -103,36 +137,49 @@ void TextRenderer::renderText(unsigned int shader, const std::string& text, floa
         float h = ch.Size.y * scale;
 
         float vertices[6][4] = {
-            { xpos, ypos + h, 0.0f, 0.0f },
-            { xpos, ypos, 0.0f, 1.0f },
-            { xpos + w, ypos, 1.0f, 1.0f },
+            { xpos, ypos + h, ch.UvMin.x, ch.UvMin.y },
+            { xpos, ypos, ch.UvMin.x, ch.UvMax.y },
+            { xpos + w, ypos, ch.UvMax.x, ch.UvMax.y },
 
-            { xpos, ypos + h, 0.0f, 0.0f },
-            { xpos + w, ypos, 1.0f, 1.0f },
-            { xpos + w, ypos + h, 1.0f, 0.0f }
+            { xpos, ypos + h, ch.UvMin.x, ch.UvMin.y },
+            { xpos + w, ypos, ch.UvMax.x, ch.UvMax.y },
+            { xpos + w, ypos + h, ch.UvMax.x, ch.UvMin.y }
         };
+        Vertices.insert(Vertices.end(), &vertices[0][0], &vertices[0][0] + 24);
 
-        glBindTexture(GL_TEXTURE_2D, ch.TextureID);
-        glBindBuffer(GL_ARRAY_BUFFER, VBO);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices);
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
-
-        glDrawArrays(GL_TRIANGLES, 0, 6);
         x += (ch.Advance >> 6) * scale;
     }
 
-    glBindVertexArray(0);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    if (Vertices.empty()) {
+        return;
+    }
+
+    glState.useProgram(program.id);
+    glUniform3f(program.textColor, color.x, color.y, color.z);
+    glState.bindTexture(AtlasTexture);
+    glState.bindVertexArray(VAO);
+
+    // Bafer se povećava samo kada string ne staje, inače se samo prepisuje
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    if (Vertices.size() > BufferCapacity) {
+        BufferCapacity = Vertices.size();
+        glBufferData(GL_ARRAY_BUFFER, BufferCapacity * sizeof(float), Vertices.data(), GL_DYNAMIC_DRAW);
+    }
+    else {
+        glBufferSubData(GL_ARRAY_BUFFER, 0, Vertices.size() * sizeof(float), Vertices.data());
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glDrawArrays(GL_TRIANGLES, 0, (GLsizei)(Vertices.size() / 4));
 }
 
 float TextRenderer::calculateTextWidth(const std::string& text, float scale) {
     float width = 0.0f;
     for (char c : text) {
-        if (Characters.find(c) != Characters.end()) {
-            Character ch = Characters[c];
-            width += (ch.Advance >> 6) * scale; // Advance u pikselima
+        unsigned char code = (unsigned char)c;
+        if (code < Characters.size()) {
+            width += (Characters[code].Advance >> 6) * scale; // Advance u pikselima
         }
     }
     return width;
 }
-
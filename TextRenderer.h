@@ -4,32 +4,43 @@
 #include <ft2build.h>
 #include FT_FREETYPE_H
 
-#include <map>
+#include <array>
+#include <vector>
 #include <glm/vec2.hpp>
 #include <glm/vec3.hpp>
 #include <glm/mat4x4.hpp>
 #include <string>
+#include "ShaderProgram.h"
 
+// Glif u atlasu: UvMin je gornji lijevi, a UvMax donji desni ugao slike glifa
 struct Character {
-    unsigned int TextureID;
+    glm::vec2 UvMin;
+    glm::vec2 UvMax;
     glm::ivec2 Size;
     glm::ivec2 Bearing;
     unsigned int Advance;
 };
 
+// Svi ASCII glifi su u jednoj teksturi (atlasu), pa se cijeli string crta jednim pozivom
 class TextRenderer {
 public:
     TextRenderer(unsigned int width, unsigned int height);
 
     void loadFont(const char* fontPath);
 
-    void renderText(unsigned int shader, const std::string& text, float x, float y, float scale, glm::vec3 color);
-    void setProjection(unsigned int shader, unsigned int width, unsigned int height);
+    void renderText(const TextProgram& program, const std::string& text, float x, float y, float scale, glm::vec3 color);
+    void setProjection(const TextProgram& program, unsigned int width, unsigned int height);
     float calculateTextWidth(const std::string& text, float scale);
 
 private:
-    std::map<char, Character> Characters;
+    static const int AtlasWidth = 1024;
+    static const int GlyphPadding = 1;
+
+    std::array<Character, 128> Characters;
+    unsigned int AtlasTexture;
     unsigned int VAO, VBO;
+    std::vector<float> Vertices;               // Verteksi cijelog stringa, memorija se ponovo koristi
+    size_t BufferCapacity;                     // Koliko floatova trenutno staje u VBO
 
     void initRenderData();
 };
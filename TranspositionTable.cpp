@@ -0,0 +1,69 @@
+﻿#include "TranspositionTable.h"
+
+namespace {
+
+    uint64_t pack(Move move, int score, int depth, Bound bound) {
+        return (uint64_t)move.raw()
+            | ((uint64_t)(uint16_t)(int16_t)score << 16)
+            | ((uint64_t)(uint8_t)depth << 32)
+            | ((uint64_t)bound << 40);
+    }
+}
+
+TranspositionTable::TranspositionTable(int megabytes) : mask(0) {
+    resize(megabytes);
+}
+
+// Broj ulaza se zaokružuje naniže na stepen dvojke, pa se indeks računa maskom
+void TranspositionTable::resize(int megabytes) {
+    uint64_t count = 1;
+    uint64_t bytes = (uint64_t)(megabytes > 0 ? megabytes : 1) * 1024 * 1024;
+    while (count * 2 * sizeof(Slot) <= bytes) {
+        count *= 2;
+    }
+
+    slots.reset(new Slot[count]);
+    mask = count - 1;
+    clear();
+}
+
+void TranspositionTable::clear() {
+    for (uint64_t i = 0; i <= mask; ++i) {
+        slots[i].check.store(0, std::memory_order_relaxed);
+        slots[i].data.store(0, std::memory_order_relaxed);
+    }
+}
+
+bool TranspositionTable::probe(uint64_t key, TTEntry& entry) const {
+    const Slot& slot = slots[key & mask];
+    uint64_t data = slot.data.load(std::memory_order_relaxed);
+    uint64_t check = slot.check.load(std::memory_order_relaxed);
+    if ((check ^ data) != key || (Bound)((data >> 40) & 3) == BoundNone) {
+        return false;
+    }
+
+    entry.move = Move::fromRaw((uint16_t)data);
+    entry.score = (int16_t)(uint16_t)(data >> 16);
+    entry.depth = (uint8_t)(data >> 32);
+    entry.bound = (Bound)((data >> 40) & 3);
+    return true;
+}
+
+// Uvijek se upisuje, osim kada ista pozicija već ima rezultat dublje pretrage
+void TranspositionTable::store(uint64_t key, Move move, int score, int depth, Bound bound) {
+    Slot& slot = slots[key & mask];
+    uint64_t oldData = slot.data.load(std::memory_order_relaxed);
+    uint64_t oldCheck = slot.check.load(std::memory_order_relaxed);
+    if ((oldCheck ^ oldData) == key && (int)(uint8_t)(oldData >> 32) > depth && bound != BoundExact) {
+        return;
+    }
+
+    // Bez poteza zadržava se potez koji je ranije nađen za istu poziciju
+    if (move == Move() && (oldCheck ^ oldData) == key) {
+        move = Move::fromRaw((uint16_t)oldData);
+    }
+
+    uint64_t data = pack(move, score, depth, bound);
+    slot.data.store(data, std::memory_order_relaxed);
+    slot.check.store(key ^ data, std::memory_order_relaxed);
+}
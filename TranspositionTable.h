@@ -0,0 +1,46 @@
+﻿#ifndef TRANSPOSITIONTABLE_H
+#define TRANSPOSITIONTABLE_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include "Move.h"
+
+// Vrsta ocjene u tabeli: tačna, donja granica (odsjecanje) ili gornja granica (nijedan potez nije popravio alfa)
+enum Bound : uint8_t {
+    BoundNone = 0,
+    BoundExact = 1,
+    BoundLower = 2,
+    BoundUpper = 3
+};
+
+struct TTEntry {
+    Move move;
+    int score;
+    int depth;
+    Bound bound;
+};
+
+// Heš tabela rezultata pretrage koju dijele sve niti bez zaključavanja. Svaki ulaz su dvije
+// 64-bitne riječi: podaci i ključ XOR podaci. Ako dvije niti istovremeno pišu u isti ulaz,
+// ključ se više ne slaže sa podacima i ulaz se jednostavno ne koristi.
+class TranspositionTable {
+private:
+    struct Slot {
+        std::atomic<uint64_t> check;           // Zobrist ključ XOR data
+        std::atomic<uint64_t> data;            // Potez, ocjena, dubina i vrsta ocjene
+    };
+
+    std::unique_ptr<Slot[]> slots;
+    uint64_t mask;                             // Broj ulaza - 1 (broj ulaza je stepen dvojke)
+
+public:
+    explicit TranspositionTable(int megabytes = 16);
+
+    void resize(int megabytes);
+    void clear();
+    bool probe(uint64_t key, TTEntry& entry) const;
+    void store(uint64_t key, Move move, int score, int depth, Bound bound);
+};
+
+#endif // TRANSPOSITIONTABLE_H
@@ -0,0 +1,53 @@
+﻿#include "Zobrist.h"
+
+uint64_t zobristPieces[2][6][64];
+uint64_t zobristSideToMove;
+uint64_t zobristCastling[16];
+uint64_t zobristEnPassantFile[8];
+
+namespace {
+
+    // Ključevi se prave iz fiksnog sjemena, pa je ključ iste pozicije isti pri svakom pokretanju
+    uint64_t nextRandom(uint64_t& state) {
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        return state * 2685821657736338717ULL;
+    }
+
+    struct ZobristInitializer {
+        ZobristInitializer() { initZobrist(); }
+    } zobristInitializer;
+}
+
+void initZobrist() {
+    uint64_t state = 1070372ULL;
+
+    for (int color = 0; color < 2; ++color) {
+        for (int type = 0; type < 6; ++type) {
+            for (int square = 0; square < 64; ++square) {
+                zobristPieces[color][type][square] = nextRandom(state);
+            }
+        }
+    }
+
+    zobristSideToMove = nextRandom(state);
+
+    // Prava se kombinuju XOR-om pojedinačnih ključeva, pa prazan skup ima ključ 0
+    uint64_t castlingKeys[4];
+    for (int i = 0; i < 4; ++i) {
+        castlingKeys[i] = nextRandom(state);
+    }
+    for (int rights = 0; rights < 16; ++rights) {
+        zobristCastling[rights] = 0;
+        for (int i = 0; i < 4; ++i) {
+            if (rights & (1 << i)) {
+                zobristCastling[rights] ^= castlingKeys[i];
+            }
+        }
+    }
+
+    for (int file = 0; file < 8; ++file) {
+        zobristEnPassantFile[file] = nextRandom(state);
+    }
+}
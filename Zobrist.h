@@ -0,0 +1,15 @@
+﻿#ifndef ZOBRIST_H
+#define ZOBRIST_H
+
+#include <cstdint>
+
+// Zobrist ključevi: svaki dio pozicije ima svoj slučajan 64-bitni broj, a ključ pozicije je
+// XOR svih koji važe. Potez mijenja ključ sa nekoliko XOR operacija, bez ponovnog računanja.
+extern uint64_t zobristPieces[2][6][64];       // Boja x tip figure x polje
+extern uint64_t zobristSideToMove;             // Dodaje se kada je crni na potezu
+extern uint64_t zobristCastling[16];           // Po jedan za svaku kombinaciju prava na rokadu
+extern uint64_t zobristEnPassantFile[8];       // Kolona en passant polja
+
+void initZobrist();
+
+#endif // ZOBRIST_H
@@ -5,8 +5,14 @@ in vec2 TexCoord;
 
 uniform sampler2D texture1;
 uniform vec4 moveColor;
+uniform bool solidColor; // mogući potezi i posljednji potez: cijeli kvadrat je moveColor, bez uzorkovanja teksture
 
 void main() {
+    if (solidColor) {
+        FragColor = moveColor;
+        return;
+    }
+
     vec4 texColor = texture(texture1, TexCoord);
 
     // Ako je fragment transparentan, odbaci ga
@@ -14,10 +20,5 @@ void main() {
         discard;
     }
 
-    // Ako je fragment dio poteza (crna tekstura), koristi moveColor
-    if (texColor.rgb == vec3(0.0, 0.0, 0.0)) {
-        FragColor = moveColor; // Boja poteza
-    } else {
-        FragColor = texColor; // Originalna boja figure
-    }
+    FragColor = texColor; // Tabla ili figura; crni pikseli figura ostaju crni
 }
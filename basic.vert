@@ -1,12 +1,25 @@
 ﻿#version 330 core
 layout(location = 0) in vec2 aPos; // pozicija verteksa
 layout(location = 1) in vec2 aTexCoord; // teksture koordinate
+layout(location = 2) in uvec2 aInstance; // po instanci figure: polje (0-63) i slika u atlasu (boja * 6 + tip)
 
 uniform mat4 model;
+uniform vec4 spriteRect; // dio teksture koji se crta: pomak (xy) i velicina (zw), (0, 0, 1, 1) je cijela tekstura
+
+uniform bool instanced; // sve figure jednim pozivom, pozicija i slika dolaze iz aInstance
+uniform vec2 squareCenters[64]; // centri polja, isti kao squareNdcTable
+uniform vec4 spriteRects[12]; // dijelovi atlasa za svaku sliku figure
 
 out vec2 TexCoord;
 
 void main() {
+    if (instanced) {
+        vec4 sprite = spriteRects[aInstance.y];
+        gl_Position = vec4(aPos + squareCenters[aInstance.x], 0.0, 1.0);
+        TexCoord = sprite.xy + aTexCoord * sprite.zw;
+        return;
+    }
+
     gl_Position = model * vec4(aPos, 0.0, 1.0); // pretvaramo 2d prostor u 4d potreban za transformacije i projekcije u OpnGL - u, model transformice vertekse iz lokalnih u world space koordinate
-    TexCoord = aTexCoord;
+    TexCoord = spriteRect.xy + aTexCoord * spriteRect.zw;
 }
@@ -8,44 +8,172 @@
 #include "stb_image.h"
 #include <vector>
 #include "Piece.h"
+#include "PieceSet.h"
+#include "Board.h"
+#include "MoveGen.h"
+#include "GameStatus.h"
+#include "MoveNotation.h"
+#include "Search.h"
+#include "SquareNdc.h"
+#include "SpriteAtlas.h"
+#include "PieceRenderer.h"
+#include "ShaderProgram.h"
+#include "GlState.h"
+#include "BoardLayer.h"
 #include <glm/ext/matrix_float4x4.hpp>
 #include <glm/ext/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include <cmath>
+#include <thread>
+#include <atomic>
+#include <cstdlib>
 #include "TextRenderer.h"
 
 // Deklaracije funkcija
 unsigned int createShaderProgram(const char* vertexPath, const char* fragmentPath);
 unsigned int loadTexture(const char* path);
 void setupChessboardVAO(unsigned int& VAO, unsigned int& VBO, unsigned int& EBO);
-void drawChessboard(unsigned int shader, unsigned int VAO, unsigned int texture);
+void drawChessboard(const BasicProgram& program, unsigned int VAO, unsigned int texture);
 std::string readShaderFile(const char* filePath);
 void mouseToOpenGL(GLFWwindow* window, double xpos, double ypos, float& xOut, float& yOut);
 void mouseButtonCallback(GLFWwindow* window, int button, int action, int mods);
-std::vector<std::unique_ptr<Piece>> initializeChessPieces();
-void drawPieces(const std::vector<std::unique_ptr<Piece>>& pieces, unsigned int shader, unsigned int pieceVAO);
-void setupPieceVAO(unsigned int& VAO, unsigned int& VBO, unsigned int& EBO);
-void drawPossibleMoves(const std::vector<Position>& moves, unsigned int shader, unsigned int VAO);
+bool initializeChessPieces(const char* fen);
+void drawPossibleMoves(const std::vector<Square>& moves, const BasicProgram& program, unsigned int VAO);
+void drawBoardLayer(const BasicProgram& program, unsigned int VAO, unsigned int texture, unsigned int moveVAO,
+    TextRenderer& textRenderer, const TextProgram& textProgram);
 void setupMoveVAO(unsigned int& VAO, unsigned int& VBO, unsigned int& EBO);
-std::string toChessNotation(int row, int col);
-bool isCheckmate(const std::vector<std::unique_ptr<Piece>>& pieces, std::vector<std::vector<Piece*>>& board, Color kingColor);
+bool finishTurn(GLFWwindow* window);
+void playMove(Move move);
+void startEngineSearch();
+void playEngineMove(GLFWwindow* window);
+void cancelEngineSearch();
 void drawTimer(float whiteTimeLeft, float blackTimeLeft, bool isWhiteTurn);
 unsigned int createTextShader();
-
-Piece* selectedPiece = nullptr;
-std::vector<std::unique_ptr<Piece>> pieces;
-std::vector<std::vector<Piece*>> board(8, std::vector<Piece*>(8, nullptr));
+void invalidate(int regions);
+void settleClock();
+double secondsUntilClockTick();
+
+// Dijelovi prozora koje treba ponovo nacrtati
+enum DirtyRegion {
+    DirtyHeader = 1,                           // Satovi i ko je na potezu
+    DirtyBoard = 2,                            // Tabla, figure i mogući potezi
+    DirtyAll = DirtyHeader | DirtyBoard
+};
+
+int selectedPiece = -1;                        // Indeks u pieces, -1 ako nije izabrana figura
+std::vector<Square> selectedMoves;             // Polja na koja izabrana figura može da ode
+PieceSet pieces;
+Board board;
 bool isWhiteTurn = true;
 float whiteTimeLeft = 25 * 60.0f;
 float blackTimeLeft = 25 * 60.0f;
 double lastTime = glfwGetTime();
 bool isPaused = false;
+int dirtyRegions = DirtyAll;                   // Kombinacija DirtyRegion bitova, crta se samo kada nije 0
+GlBindCounters lastFrameBinds = {};            // Vezivanja programa, VAO i tekstura u posljednjem nacrtanom kadru
+bool showCoordinates = false;                  // Oznake kolona i redova na tabli
+bool engineControls[2] = { false, false };     // Da li računar igra za bijelog / crnog
+const double engineSecondsPerMove = 1.0;
+const int defaultEngineThreads = 2;            // Računar ne zauzima sva jezgra; mijenja se opcijom --threads
+Engine engine(defaultEngineThreads);
+std::thread engineThread;                      // Pretraga radi van GLFW niti, pa prozor i dalje prima događaje
+std::atomic<bool> engineDone(false);           // Pretraga je završila i engineResult je spreman
+bool engineThinking = false;                   // engineThread je pokrenut i još nije spojen
+Board engineBoard;                             // Kopija table za pretragu; board mijenja samo glavna nit
+SearchResult engineResult;
 
 void keyCallback(GLFWwindow* window, int key, int scancode, int action, int mods) {
+    if (action == GLFW_PRESS) {
+        invalidate(DirtyAll);
+    }
+
+    // Pauza prekida i pretragu računara, koja počinje ispočetka kada se igra nastavi
     if (key == GLFW_KEY_SPACE && action == GLFW_PRESS) {
+        cancelEngineSearch();
+        settleClock();
         isPaused = !isPaused; // Prebacivanje između pauze i pokretanja
         std::cout << (isPaused ? "Timer paused." : "Timer resumed.") << std::endl;
     }
+
+    // Računar preuzima ili vraća igru strane koja je na potezu
+    if (key == GLFW_KEY_E && action == GLFW_PRESS) {
+        cancelEngineSearch();
+        bool& controlled = engineControls[(int)board.getSideToMove()];
+        controlled = !controlled;
+        selectedPiece = -1;
+        std::cout << (board.getSideToMove() == Color::White ? "White" : "Black")
+            << (controlled ? " is now played by the computer." : " is now played by a human.") << std::endl;
+    }
+
+    // Vraćanje posljednjeg poteza, figure se ponovo prave iz stanja table. Kada bi nakon vraćanja
+    // na potezu bio računar protiv čovjeka, vraća se i potez čovjeka, inače bi računar odmah igrao ponovo.
+    if (key == GLFW_KEY_BACKSPACE && action == GLFW_PRESS) {
+        cancelEngineSearch();
+        Color afterUndo = oppositeColor(board.getSideToMove());
+        bool againstEngine = engineControls[(int)afterUndo] && !engineControls[(int)board.getSideToMove()];
+        if (board.unmakeMove()) {
+            if (againstEngine) {
+                board.unmakeMove();
+            }
+            settleClock();
+            pieces.loadFromBoard(board);
+            selectedPiece = -1;
+            isWhiteTurn = board.getSideToMove() == Color::White;
+            std::cout << "Move undone." << std::endl;
+        }
+        else {
+            std::cout << "No move to undo." << std::endl;
+        }
+    }
+
+    // Koliko vezivanja je keš stanja preskočio u posljednjem kadru
+    if (key == GLFW_KEY_S && action == GLFW_PRESS) {
+        std::cout << "Last frame binds (done/skipped): program " << lastFrameBinds.programBinds << "/" << lastFrameBinds.programSkips
+            << ", VAO " << lastFrameBinds.vertexArrayBinds << "/" << lastFrameBinds.vertexArraySkips
+            << ", texture " << lastFrameBinds.textureBinds << "/" << lastFrameBinds.textureSkips << std::endl;
+    }
+
+    // Uključivanje i isključivanje oznaka kolona i redova
+    if (key == GLFW_KEY_C && action == GLFW_PRESS) {
+        showCoordinates = !showCoordinates;
+    }
+
+    // Trenutna pozicija kao FEN se ispisuje i kopira u clipboard
+    if (key == GLFW_KEY_F && action == GLFW_PRESS) {
+        char fen[Board::MaxFenLength];
+        board.writeFen(fen);
+        glfwSetClipboardString(window, fen);
+        std::cout << "FEN: " << fen << std::endl;
+    }
+
+    // Potez iz clipboarda u obliku "e2e4" ili "e7e8n"
+    if (key == GLFW_KEY_M && action == GLFW_PRESS) {
+        const char* text = glfwGetClipboardString(window);
+        Move move;
+        if (engineControls[(int)board.getSideToMove()]) {
+            std::cout << "The computer is on the move." << std::endl;
+        }
+        else if (text && moveFromNotation(board, text, move)) {
+            selectedPiece = -1;
+            std::cout << "Clipboard move: " << moveToNotation(move) << std::endl;
+            playMove(move);
+            finishTurn(window);
+        }
+        else {
+            std::cout << "Clipboard does not contain a legal move." << std::endl;
+        }
+    }
+
+    // Pozicija iz FEN zapisa u clipboardu
+    if (key == GLFW_KEY_V && action == GLFW_PRESS) {
+        const char* fen = glfwGetClipboardString(window);
+        if (fen && initializeChessPieces(fen)) {
+            std::cout << "Loaded FEN: " << fen << std::endl;
+        }
+        else {
+            std::cout << "Clipboard does not contain a valid FEN, the game continues." << std::endl;
+        }
+    }
 }
 
 // Provjera OpenGL grešaka
@@ -70,7 +198,9 @@ std::string pieceTypeToString(PieceType type) {
 
 
 
-int main() {
+// Opcioni argumenti su FEN pozicija od koje partija počinje, npr. Sablon 8/8/8/4k3/8/8/8/R3K3 w - - 0 1,
+// i --threads N, broj niti pretrage računara (podrazumijevano defaultEngineThreads)
+int main(int argc, char* argv[]) {
     if (!glfwInit()) {
         std::cerr << "Failed to initialize GLFW!" << std::endl;
         return -1;
@@ -107,105 +237,178 @@ int main() {
     unsigned int textShader = createShaderProgram("text.vert", "text.frag");
     if (textShader == 0) return -1;
 
+    BasicProgram basicProgram(shaderProgram);
+    TextProgram textProgram(textShader);
+
     unsigned int texture = loadTexture("res/chessboard.png");
     if (texture == 0) return -1;
 
+    // Slike figura se dekodiraju samo jednom, u atlas koji traje do kraja programa
+    SpriteAtlas pieceAtlas;
+    if (!pieceAtlas.load()) return -1;
+
     unsigned int VAO, VBO, EBO; // osnovni objekti u OpenGL - VAO skladisti informacije o tjemenima, VBO - teksture, boje, koordinate, EBO - indekse za crtanje(reodlsijed kojim se crta)
     setupChessboardVAO(VAO, VBO, EBO);
 
-    unsigned int pieceVAO, pieceVBO, pieceEBO;
-    setupPieceVAO(pieceVAO, pieceVBO, pieceEBO);
+    PieceRenderer pieceRenderer;
+    pieceRenderer.init(basicProgram, pieceAtlas);
 
     unsigned int moveVAO, moveVBO, moveEBO;
     setupMoveVAO(moveVAO, moveVBO, moveEBO);
 
-    pieces = initializeChessPieces();
+    std::string startPosition;
+    for (int i = 1; i < argc; ++i) {
+        if (std::string(argv[i]) == "--threads" && i + 1 < argc) {
+            engine.setThreads(std::atoi(argv[++i]));
+            continue;
+        }
+        startPosition += argv[i];
+        startPosition += ' ';
+    }
+    if (!initializeChessPieces(!startPosition.empty() ? startPosition.c_str() : startFen)) {
+        std::cerr << "Invalid FEN, starting from the initial position: " << startPosition << std::endl;
+        initializeChessPieces(startFen);
+    }
 
     // Inicijalizacija TextRenderer-a
     TextRenderer textRenderer(800, 900);
     textRenderer.loadFont("Montserrat-Regular.ttf");
-    textRenderer.setProjection(textShader, 800, 100);
+    textRenderer.setProjection(textProgram, 800, 100);
+
+    // Statični sloj table; ako framebuffer nije podržan, tabla se crta direktno u svakom kadru
+    BoardLayer boardLayer;
+    bool boardLayerReady = boardLayer.init(800, 800);
+
+    // Pripremni kod je vezivao objekte direktno, pa keš stanja kreće od nepoznatog stanja
+    glState.reset();
 
     glfwSetMouseButtonCallback(window, mouseButtonCallback); // Opet CallBack funckija, vraca info o kliknutom misu
+    glfwSetWindowRefreshCallback(window, [](GLFWwindow*) { invalidate(DirtyAll); }); // Prozor je otkriven ili mu je promijenjena veličina
+
+    // Tekst zaglavlja se pravi ponovo samo kada je zaglavlje označeno za ponovno crtanje
+    std::string whiteTime, blackTime, currentPlayer;
+    float currentPlayerX = 0.0f;
+    int shownWhiteSeconds = -1;
+    int shownBlackSeconds = -1;
 
     while (!glfwWindowShouldClose(window)) {
-        double currentTime = glfwGetTime(); // Skladistimo vrijeme koje je proslo od posledje iteracije
-        double deltaTime = currentTime - lastTime;
-        lastTime = currentTime;
-
-        if (!isPaused) {
-            if (isWhiteTurn) {
-                whiteTimeLeft -= deltaTime;
-                if (whiteTimeLeft <= 0) {
-                    std::cout << "Time's up! Black wins!" << std::endl;
-                    glfwSetWindowShouldClose(window, true);
+        // Događaji koji mijenjaju pauzu ili stranu na potezu već su obračunali sat u trenutku kada su
+        // se desili, pa se ovdje oduzima samo vrijeme od posljednjeg obračuna
+        settleClock();
+        if (whiteTimeLeft <= 0) {
+            std::cout << "Time's up! Black wins!" << std::endl;
+            glfwSetWindowShouldClose(window, true);
+        }
+        else if (blackTimeLeft <= 0) {
+            std::cout << "Time's up! White wins!" << std::endl;
+            glfwSetWindowShouldClose(window, true);
+        }
+
+        // Sat prikazuje cijele sekunde, pa se zaglavlje mijenja tek kada se promijeni prikazana sekunda
+        if ((int)whiteTimeLeft != shownWhiteSeconds || (int)blackTimeLeft != shownBlackSeconds) {
+            shownWhiteSeconds = (int)whiteTimeLeft;
+            shownBlackSeconds = (int)blackTimeLeft;
+            invalidate(DirtyHeader);
+        }
+
+        if (dirtyRegions & DirtyHeader) {
+            int whiteMinutes = static_cast<int>(whiteTimeLeft / 60);
+            int whiteSeconds = static_cast<int>(fmod(whiteTimeLeft, 60.0f));
+            whiteTime = "White Timer: " + std::to_string(whiteMinutes) + ":" +
+                (whiteSeconds < 10 ? "0" : "") + std::to_string(whiteSeconds);
+
+            int blackMinutes = static_cast<int>(blackTimeLeft / 60);
+            int blackSeconds = static_cast<int>(fmod(blackTimeLeft, 60.0f));
+            blackTime = "Black Timer: " + std::to_string(blackMinutes) + ":" +
+                (blackSeconds < 10 ? "0" : "") + std::to_string(blackSeconds);
+
+            currentPlayer = isWhiteTurn ? "White's Turn" : "Black's Turn";
+            float textWidth = textRenderer.calculateTextWidth(currentPlayer, 0.8f);
+            currentPlayerX = 800.0f - textWidth - 10.0f; // Desna strana sa marginom od 10 piksela
+        }
+
+        if (dirtyRegions & DirtyBoard) {
+            pieceRenderer.update(pieces, board.getKey());
+        }
+
+        // Zadnji bafer nakon glfwSwapBuffers nema definisan sadržaj, pa se prozor, kada se bilo šta
+        // promijeni, crta cijeli; bez promjena se ne crta ništa
+        if (dirtyRegions != 0) {
+            glState.beginFrame();
+
+            // Brisanje ekrana
+            glClearColor(0.2f, 0.2f, 0.2f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT);
+
+            // Crtanje tekstualnog interfejsa
+            glViewport(0, 800, 800, 100); // Prostor za tekst, odnosno gornji prozor
+
+            // Ispisuje preostalo vrijeme za oba igrača
+            textRenderer.renderText(textProgram, whiteTime, 10.0f, 80.0f, 0.8f, glm::vec3(1.0f, 1.0f, 1.0f));
+            textRenderer.renderText(textProgram, blackTime, 10.0f, 50.0f, 0.8f, glm::vec3(1.0f, 1.0f, 1.0f));
+
+            textRenderer.renderText(textProgram, "Nikola Pejanovic RA 237-2021", 10.0f, 20.0f, 0.4f, glm::vec3(0.8f, 0.3f, 0.2f));
+            textRenderer.renderText(textProgram, currentPlayer, currentPlayerX, 40.0f, 0.8f, glm::vec3(1.0f, 1.0f, 1.0f));
+
+            // Crtanje šahovske table: slika table, koordinate i posljednji potez se crtaju u sloj samo
+            // kada se promijene, a u svakom kadru se sloj samo kopira
+            uint32_t layerKey = board.getLastMove().raw() | (showCoordinates ? 0x10000u : 0u);
+            if (boardLayerReady) {
+                if (boardLayer.needsRender(layerKey)) {
+                    boardLayer.begin();
+                    drawBoardLayer(basicProgram, VAO, texture, moveVAO, textRenderer, textProgram);
+                    boardLayer.end(layerKey);
                 }
+                boardLayer.blit(0, 0);
+                glViewport(0, 0, 800, 800); // Prostor za tablu
             }
             else {
-                blackTimeLeft -= deltaTime;
-                if (blackTimeLeft <= 0) {
-                    std::cout << "Time's up! White wins!" << std::endl;
-                    glfwSetWindowShouldClose(window, true);
-                }
+                glViewport(0, 0, 800, 800);
+                drawBoardLayer(basicProgram, VAO, texture, moveVAO, textRenderer, textProgram);
             }
+            pieceRenderer.draw(basicProgram, pieceAtlas);
+
+            // Crtanje mogućih poteza
+            if (selectedPiece >= 0) {
+                drawPossibleMoves(selectedMoves, basicProgram, moveVAO);
+            }
+
+            glfwSwapBuffers(window);
+            dirtyRegions = 0;
+            lastFrameBinds = glState.getCounters();
         }
 
-        // Brisanje ekrana
-        glClearColor(0.2f, 0.2f, 0.2f, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT);
-
-        // Crtanje tekstualnog interfejsa
-        glViewport(0, 800, 800, 100); // Prostor za tekst, odnosno gornji prozor
-        glUseProgram(textShader);
-
-        int whiteMinutes = static_cast<int>(whiteTimeLeft / 60);
-        int whiteSeconds = static_cast<int>(fmod(whiteTimeLeft, 60.0f));
-        std::string whiteTime = "White Timer: " + std::to_string(whiteMinutes) + ":" +
-            (whiteSeconds < 10 ? "0" : "") + std::to_string(whiteSeconds);
-
-        int blackMinutes = static_cast<int>(blackTimeLeft / 60);
-        int blackSeconds = static_cast<int>(fmod(blackTimeLeft, 60.0f));
-        std::string blackTime = "Black Timer: " + std::to_string(blackMinutes) + ":" +
-            (blackSeconds < 10 ? "0" : "") + std::to_string(blackSeconds);
-
-        // Ispisuje preostalo vrijeme za oba igrača
-        textRenderer.renderText(textShader, whiteTime, 10.0f, 80.0f, 0.8f, glm::vec3(1.0f, 1.0f, 1.0f));
-        textRenderer.renderText(textShader, blackTime, 10.0f, 50.0f, 0.8f, glm::vec3(1.0f, 1.0f, 1.0f));
-        
-        
-        textRenderer.renderText(textShader, "Nikola Pejanovic RA 237-2021", 10.0f, 20.0f, 0.4f, glm::vec3(0.8f, 0.3f, 0.2f));
-
-        std::string currentPlayer = isWhiteTurn ? "White's Turn" : "Black's Turn";
-        float textWidth = textRenderer.calculateTextWidth(currentPlayer, 0.8f);
-        float xPosition = 800.0f - textWidth - 10.0f; // Desna strana sa marginom od 10 piksela
-        textRenderer.renderText(textShader, currentPlayer, xPosition, 40.0f, 0.8f, glm::vec3(1.0f, 1.0f, 1.0f));
-
-
-        // Crtanje šahovske table
-        glViewport(0, 0, 800, 800); // Prostor za tablu
-        drawChessboard(shaderProgram, VAO, texture);
-        drawPieces(pieces, shaderProgram, pieceVAO);
-
-        // Crtanje mogućih poteza
-        if (selectedPiece) {
-            drawPossibleMoves(selectedPiece->getPossibleMoves(), shaderProgram, moveVAO);
+        // Računar počinje da razmišlja tek kada je posljednja pozicija nacrtana. Pretraga radi u svojoj
+        // niti, pa se i tada čeka na događaj ili na sljedeću sekundu sata (dok je sat pauziran samo na
+        // događaj); kraj pretrage budi petlju praznim događajem
+        if (!isPaused && engineControls[(int)board.getSideToMove()] && !engineThinking && !glfwWindowShouldClose(window)) {
+            startEngineSearch();
+        }
+
+        if (isPaused) {
+            glfwWaitEvents();
+        }
+        else {
+            glfwWaitEventsTimeout(secondsUntilClockTick());
         }
 
-        // Mjenjamo bafere i procesiramo događaje
-        glfwSwapBuffers(window);
-        glfwPollEvents();
+        if (engineThinking && engineDone.load()) {
+            playEngineMove(window);
+        }
     }
 
+    cancelEngineSearch();
+
     // 5. Oslobađanje resursa
     glDeleteProgram(shaderProgram);
     glDeleteProgram(textShader);
     glDeleteTextures(1, &texture);
+    pieceAtlas.release();
+    boardLayer.release();
     glDeleteVertexArrays(1, &VAO);
     glDeleteBuffers(1, &VBO);
     glDeleteBuffers(1, &EBO);
-    glDeleteVertexArrays(1, &pieceVAO);
-    glDeleteBuffers(1, &pieceVBO);
-    glDeleteBuffers(1, &pieceEBO);
+    pieceRenderer.release();
     glDeleteVertexArrays(1, &moveVAO);
     glDeleteBuffers(1, &moveVBO);
     glDeleteBuffers(1, &moveEBO);
@@ -322,19 +525,16 @@ void setupMoveVAO(unsigned int& VAO, unsigned int& VBO, unsigned int& EBO) {
     glBindVertexArray(0);
 }
 
-void drawChessboard(unsigned int shader, unsigned int VAO, unsigned int texture) {
-    glUseProgram(shader);
+void drawChessboard(const BasicProgram& program, unsigned int VAO, unsigned int texture) {
+    glState.useProgram(program.id);
 
     glm::mat4 model = glm::mat4(1.0f); // Matrica bez transformacija, sto znaci objekat ce biti nacrtan na svojoj poziciji
-    unsigned int modelLoc = glGetUniformLocation(shader, "model"); // Traži lokaciju uniformne promenljive model u šejder programu (npr. u vertex shader-u). Uniformna promjenljiva se obicno koristi za transformaciju objekata u prostoru
-    glUniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(model)); // Postavlja vrijednosti uniformne matrice model u sejder programa
+    glUniformMatrix4fv(program.model, 1, GL_FALSE, glm::value_ptr(model)); // Postavlja vrijednosti uniformne matrice model u sejder programa; lokacija je pročitana jednom, u BasicProgram
+    glUniform4f(program.spriteRect, 0.0f, 0.0f, 1.0f, 1.0f); // Cijela tekstura table
 
-    glBindTexture(GL_TEXTURE_2D, texture);
-    glBindVertexArray(VAO);
+    glState.bindTexture(texture);
+    glState.bindVertexArray(VAO);
     glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-    glBindVertexArray(0);
-
-    glUseProgram(0);
 }
 
 
@@ -426,8 +626,9 @@ void mouseToOpenGL(GLFWwindow* window, double xpos, double ypos, float& xOut, fl
 }
 
 bool canMove(Color pieceColor) {
-    // Provjerava da li figura može da igra na osnovu poteza
-    return (pieceColor == Color::White && isWhiteTurn) || (pieceColor == Color::Black && !isWhiteTurn);
+    // Provjerava da li figura može da igra na osnovu poteza; figurama računara čovjek ne igra
+    return !engineControls[(int)pieceColor] &&
+        ((pieceColor == Color::White && isWhiteTurn) || (pieceColor == Color::Black && !isWhiteTurn));
 }
 
 
@@ -444,486 +645,296 @@ void mouseButtonCallback(GLFWwindow* window, int button, int action, int mods) {
             return;
         }
 
+        // Klikovi iz reda događaja dok igra računar se ne smiju pretvoriti u njegove poteze
+        if (engineControls[(int)board.getSideToMove()]) {
+            selectedPiece = -1;
+            return;
+        }
+        invalidate(DirtyBoard);
+
         // Mapiranje OpenGL koordinata na redove i kolone šahovske table
         int col = (int)((xGL + 1.0f) / (2.0f / 8.0f)); // 8 kolona
         int row = (int)((1.0f - yGL) / (2.0f / 8.0f)); // 8 redova
 
         if (col >= 0 && col < 8 && row >= 0 && row < 8) {
-            if (selectedPiece == nullptr) {
-                for (const auto& piece : pieces) {
-                    if (piece && piece->isAt(row, col) && !piece->getIsCaptured()) {
-
-                        if (!canMove(piece->getColor())) {
-                            std::cout << "Not your turn!" << std::endl;
-                            return;
-                        }
-
-                        selectedPiece = piece.get();
-
-                        // Dodaj ispis za selektovanu figuru
-                        std::cout << "Selected piece: " << piece->getName() << "\n";
-                        std::cout << "Color: " << (piece->getColor() == Color::White ? "White" : "Black") << "\n";
-                        std::cout << "Current Position: "
-                            << toChessNotation(piece->getCurrentPosition().getRow(),
-                                piece->getCurrentPosition().getColumn()) << "\n";
-                        std::cout << "Possible Moves: ";
-                        piece->calculatePossibleMoves(board);
-                        for (const auto& move : piece->getPossibleMoves()) {
-                            std::cout << toChessNotation(move.getRow(), move.getColumn()) << " ";
-                        }
-                        std::cout << "\n";
-
-                        // Ako je kralj u šahu, filtriraj poteze
-                        if (Piece::isKingInCheck(pieces, board, selectedPiece->getColor())) {
-                            auto filteredMoves = selectedPiece->filterMovesToAvoidCheck(
-                                selectedPiece->getPossibleMoves(),
-                                pieces,
-                                board,
-                                selectedPiece->getColor()
-                            );
-
-
-                            // Postavi filtrirane poteze kao validne poteze
-                            selectedPiece->setPossibleMoves(filteredMoves);
-                        }
-
-                        break;
+            Square clicked = (Square)makeSquare(row, col);
+
+            if (selectedPiece < 0) {
+                int piece = pieces.findAt(clicked);
+                if (piece < 0) {
+                    return;
+                }
+
+                if (!canMove(pieces.getColor(piece))) {
+                    std::cout << "Not your turn!" << std::endl;
+                    return;
+                }
+
+                selectedPiece = piece;
+
+                // Od svih legalnih poteza uzmi one koji kreću sa polja ove figure.
+                // Promocija daje četiri poteza na isto polje, dovoljno je zapamtiti jedan.
+                selectedMoves.clear();
+                for (Move move : generateLegalMoves(board)) {
+                    if (move.from() == clicked && (!move.isPromotion() || move.promotion() == PieceType::Queen)) {
+                        selectedMoves.push_back((Square)move.to());
                     }
                 }
+
+                // Dodaj ispis za selektovanu figuru
+                std::cout << "Selected piece: " << pieces.getName(piece) << "\n";
+                std::cout << "Color: " << (pieces.getColor(piece) == Color::White ? "White" : "Black") << "\n";
+                std::cout << "Current Position: " << squareToNotation(clicked) << "\n";
+                std::cout << "Possible Moves: ";
+                for (Square target : selectedMoves) {
+                    std::cout << squareToNotation(target) << " ";
+                }
+                std::cout << "\n";
             }
             else {
+                Square previousSquare = pieces.getSquare(selectedPiece);
+
                 // Provjeri da li je kliknuto na već selektovanu figuru
-                if (selectedPiece->isAt(row, col)) {
-                    std::cout << "Deselected piece: " << selectedPiece->getName() << std::endl;
-                    selectedPiece = nullptr; // Deselektovanje figure
+                if (clicked == previousSquare) {
+                    std::cout << "Deselected piece: " << pieces.getName(selectedPiece) << std::endl;
+                    selectedPiece = -1; // Deselektovanje figure
                     return;
                 }
 
-                // Pokušaj pomeranja figure
-                std::string nazivPolja = "";
-                auto previousPosition = selectedPiece->getCurrentPosition();
-                int oldRow = previousPosition.getRow();
-                int oldCol = previousPosition.getColumn();
-
-                selectedPiece->setPosition(row, col, nazivPolja, board);
-
-                // Provjera da li je figura stvarno pomjerena
-                auto newPosition = selectedPiece->getCurrentPosition();
-                if (newPosition.getRow() == oldRow && newPosition.getColumn() == oldCol) {
-                    // Figura nije pomjerena
+                // Potez sa flagovima (uzimanje, rokada, en passant) daje generator, promocija je uvijek u kraljicu
+                Move move;
+                if (!findLegalMove(board, previousSquare, clicked, PieceType::Queen, move)) {
                     std::cout << "Invalid move! Try again." << std::endl;
                     return;
                 }
 
-                // Ispis pomeranja figure
-                std::cout << selectedPiece->getName() << " moved from "
-                    << toChessNotation(oldRow, oldCol) << " to "
-                    << toChessNotation(row, col) << "." << std::endl;
-
-                // Provjera šaha ili šah-mata
-                if (Piece::isKingInCheck(pieces, board, Color::White)) {
-                    std::cout << "White King is in check!" << std::endl;
-                    if (isCheckmate(pieces, board, Color::White)) {
-                        std::cout << "Checkmate! Black wins!" << std::endl;
-                        glfwSetWindowShouldClose(window, true);
-                        return;
-                    }
-                }
+                playMove(move);
 
-                if (Piece::isKingInCheck(pieces, board, Color::Black)) {
-                    std::cout << "Black King is in check!" << std::endl;
-                    if (isCheckmate(pieces, board, Color::Black)) {
-                        std::cout << "Checkmate! White wins!" << std::endl;
-                        glfwSetWindowShouldClose(window, true);
-                        return;
-                    }
-                }
+                // Ispis pomeranja figure, u istom zapisu kao potezi računara
+                std::cout << pieces.getName(selectedPiece) << " plays " << moveToNotation(move) << std::endl;
 
-                // Prebacivanje poteza na drugog igrača
-                isWhiteTurn = !isWhiteTurn;
-                selectedPiece = nullptr;
+                finishTurn(window);
             }
         }
     }
 }
 
+// Odigrava legalan potez na tabli i na figurama za prikaz
+void playMove(Move move) {
+    if (move.isCapture()) {
+        int captureSquare = move.isEnPassant() ? makeSquare(squareRow(move.from()), squareColumn(move.to())) : move.to();
+        int victim = pieces.findAt((Square)captureSquare);
+        if (victim >= 0) {
+            std::cout << "Piece " << pieces.getName(pieces.findAt((Square)move.from())) << " ate " << pieces.getName(victim) << std::endl;
+        }
+    }
 
-
-std::string toChessNotation(int row, int col) {
-    char colChar = 'A' + col;  // Pretvara broj u odgovarajući karakter (0 -> 'A', 1 -> 'B', ...)
-    int rowNum = 8 - row;  // Redovi se numerišu od 1 do 8, pa je potrebno invertovati broj
-
-    return std::string(1, colChar) + std::to_string(rowNum);  // Kombinovanje kolone i reda
+    pieces.applyMove(move);
+    board.makeMove(move);
+    invalidate(DirtyBoard);
 }
 
+// Provjera šaha, mata ili pata nakon odigranog poteza i prebacivanje poteza na drugog igrača.
+// Vraća false ako je partija završena.
+bool finishTurn(GLFWwindow* window) {
+    Color side = board.getSideToMove();
+    const char* sideName = (side == Color::White) ? "White" : "Black";
+    const char* otherName = (side == Color::White) ? "Black" : "White";
+
+    switch (getGameStatus(board)) {
+    case GameStatus::Checkmate:
+        std::cout << "Checkmate! " << otherName << " wins!" << std::endl;
+        glfwSetWindowShouldClose(window, true);
+        return false;
+    case GameStatus::Stalemate:
+        std::cout << "Stalemate! " << sideName << " has no legal moves, the game is a draw." << std::endl;
+        glfwSetWindowShouldClose(window, true);
+        return false;
+    case GameStatus::ThreefoldRepetition:
+        std::cout << "Threefold repetition, the game is a draw." << std::endl;
+        glfwSetWindowShouldClose(window, true);
+        return false;
+    case GameStatus::FiftyMoveRule:
+        std::cout << "Fifty moves without a capture or pawn move, the game is a draw." << std::endl;
+        glfwSetWindowShouldClose(window, true);
+        return false;
+    case GameStatus::Ongoing:
+        break;
+    }
 
+    if (board.isInCheck(side)) {
+        std::cout << sideName << " King is in check!" << std::endl;
+    }
 
-std::vector<std::unique_ptr<Piece>> initializeChessPieces() {
-    std::vector<std::unique_ptr<Piece>> pieces;
-
-    for (int i = 0; i < 8; ++i) {
-        pieces.push_back(std::make_unique<Piece>("Pawn", PieceType::Pawn, Color::White, Position(-0.875f + i * 0.25f, -0.625f, "A2", 6, i), "res/white_pawn.png", 1));
-        board[6][i] = pieces.back().get(); // Postavljanje belih pjesaka na tablu
-    }
-
-    // Bijele figure
-    pieces.push_back(std::make_unique<Piece>("Rook", PieceType::Rook, Color::White, Position(-0.875f, -0.875f, "A1", 7, 0), "res/white_rook.png", 5));
-    board[7][0] = pieces.back().get();
-    pieces.push_back(std::make_unique<Piece>("Knight", PieceType::Knight, Color::White, Position(-0.625f, -0.875f, "B1", 7, 1), "res/white_horse.png", 3));
-    board[7][1] = pieces.back().get();
-    pieces.push_back(std::make_unique<Piece>("Bishop", PieceType::Bishop, Color::White, Position(-0.375f, -0.875f, "C1", 7, 2), "res/white_bishop.png", 3));
-    board[7][2] = pieces.back().get();
-    pieces.push_back(std::make_unique<Piece>("Queen", PieceType::Queen, Color::White, Position(-0.125f, -0.875f, "D1", 7, 3), "res/white_queen.png", 9));
-    board[7][3] = pieces.back().get();
-    pieces.push_back(std::make_unique<Piece>("King", PieceType::King, Color::White, Position(0.125f, -0.875f, "E1", 7, 4), "res/white_king.png", 10));
-    board[7][4] = pieces.back().get();
-    pieces.push_back(std::make_unique<Piece>("Bishop", PieceType::Bishop, Color::White, Position(0.375f, -0.875f, "F1", 7, 5), "res/white_bishop.png", 3));
-    board[7][5] = pieces.back().get();
-    pieces.push_back(std::make_unique<Piece>("Knight", PieceType::Knight, Color::White, Position(0.625f, -0.875f, "G1", 7, 6), "res/white_horse.png", 3));
-    board[7][6] = pieces.back().get();
-    pieces.push_back(std::make_unique<Piece>("Rook", PieceType::Rook, Color::White, Position(0.875f, -0.875f, "H1", 7, 7), "res/white_rook.png", 5));
-    board[7][7] = pieces.back().get();
-
-    // Crni pjesaci
-    for (int i = 0; i < 8; ++i) {
-        pieces.push_back(std::make_unique<Piece>("Pawn", PieceType::Pawn, Color::Black, Position(-0.875f + i * 0.25f, 0.625f, "A7", 1, i), "res/black_pawn.png", 1));
-        board[1][i] = pieces.back().get();
-    }
-
-    // Crne figure
-    pieces.push_back(std::make_unique<Piece>("Rook", PieceType::Rook, Color::Black, Position(-0.875f, 0.875f, "A8", 0, 0), "res/black_rook.png", 5));
-    board[0][0] = pieces.back().get();
-    pieces.push_back(std::make_unique<Piece>("Knight", PieceType::Knight, Color::Black, Position(-0.625f, 0.875f, "B8", 0, 1), "res/black_horse.png", 3));
-    board[0][1] = pieces.back().get();
-    pieces.push_back(std::make_unique<Piece>("Bishop", PieceType::Bishop, Color::Black, Position(-0.375f, 0.875f, "C8", 0, 2), "res/black_bishop.png", 3));
-    board[0][2] = pieces.back().get();
-    pieces.push_back(std::make_unique<Piece>("Queen", PieceType::Queen, Color::Black, Position(-0.125f, 0.875f, "D8", 0, 3), "res/black_queen.png", 9));
-    board[0][3] = pieces.back().get();
-    pieces.push_back(std::make_unique<Piece>("King", PieceType::King, Color::Black, Position(0.125f, 0.875f, "E8", 0, 4), "res/black_king.png", 10));
-    board[0][4] = pieces.back().get();
-    pieces.push_back(std::make_unique<Piece>("Bishop", PieceType::Bishop, Color::Black, Position(0.375f, 0.875f, "F8", 0, 5), "res/black_bishop.png", 3));
-    board[0][5] = pieces.back().get();
-    pieces.push_back(std::make_unique<Piece>("Knight", PieceType::Knight, Color::Black, Position(0.625f, 0.875f, "G8", 0, 6), "res/black_horse.png", 3));
-    board[0][6] = pieces.back().get();
-    pieces.push_back(std::make_unique<Piece>("Rook", PieceType::Rook, Color::Black, Position(0.875f, 0.875f, "H8", 0, 7), "res/black_rook.png", 5));
-    board[0][7] = pieces.back().get();
-
-    return pieces;
+    settleClock();
+    isWhiteTurn = side == Color::White;
+    selectedPiece = -1;
+    invalidate(DirtyAll);
+    return true;
 }
 
+// Pokreće pretragu za stranu koja je na potezu u posebnoj niti
+void startEngineSearch() {
+    engineBoard = board;
+    engineDone.store(false);
+    engineThinking = true;
+    engineThread = std::thread([]() {
+        SearchLimits limits;
+        limits.maxSeconds = engineSecondsPerMove;
+        engineResult = engine.think(engineBoard, limits);
+        engineDone.store(true);
+        glfwPostEmptyEvent();                  // Budi glfwWaitEvents u glavnoj niti
+    });
+}
 
-void drawPieces(const std::vector<std::unique_ptr<Piece>>& pieces, unsigned int shader, unsigned int pieceVAO) {
-    for (const auto& piece : pieces) {
-        // Provjeri da li postoji figura i preskoči crtanje uhvaćenih figura
-        if (!piece || piece->getIsCaptured()) {
-            continue;
-        }
-
-        unsigned int texture = loadTexture(piece->getImagePath().c_str());
-        if (texture == 0) {
-            std::cerr << "Texture not loaded for piece: " << piece->getName() << std::endl;
-            continue;
-        }
-
-        glUseProgram(shader);
-        glBindTexture(GL_TEXTURE_2D, texture);
-
-        glm::mat4 model = glm::translate(glm::mat4(1.0f), glm::vec3(piece->getCurrentPosition().getXGL(), piece->getCurrentPosition().getYGL(), 0.0f)); // zasto matrica translacije, pa jednostavno svaka figura mora da ide na svoje mjesto na osnovu koordinata
-        unsigned int modelLoc = glGetUniformLocation(shader, "model");
-        glUniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(model));
-
-        glBindVertexArray(pieceVAO);
-        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-        glBindVertexArray(0);
-
-        glDeleteTextures(1, &texture);
+// Prekida pretragu koja je u toku i odbacuje njen rezultat. Stop se ponavlja dok pretraga ne završi,
+// jer think na svom početku spušta zastavicu, pa stop poslat prije toga ne bi bio viđen.
+void cancelEngineSearch() {
+    if (!engineThinking) {
+        return;
+    }
+    while (!engineDone.load()) {
+        engine.stop();
+        std::this_thread::yield();
     }
+    engineThread.join();
+    engineThinking = false;
 }
 
+// Računar igra potez koji je pronašla završena pretraga
+void playEngineMove(GLFWwindow* window) {
+    engineThread.join();
+    engineThinking = false;
+    const SearchResult& result = engineResult;
 
-void setupPieceVAO(unsigned int& VAO, unsigned int& VBO, unsigned int& EBO) {
-    float vertices[] = {
-        // Pozicije      // Teksturne koordinate
-        -0.1f, -0.1f,   0.0f, 0.0f, // Donji levi
-         0.1f, -0.1f,   1.0f, 0.0f, // Donji desni
-         0.1f,  0.1f,   1.0f, 1.0f, // Gornji desni
-        -0.1f,  0.1f,   0.0f, 1.0f  // Gornji levi
-    };
-
-    unsigned int indices[] = {
-        0, 1, 2,
-        2, 3, 0
-    };
-
-    glGenVertexArrays(1, &VAO);
-    glGenBuffers(1, &VBO);
-    glGenBuffers(1, &EBO);
-
-    glBindVertexArray(VAO);
-
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
-
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
+    if (result.pvLength == 0) {
+        std::cout << "Computer has no legal moves." << std::endl;
+        engineControls[(int)board.getSideToMove()] = false;
+        return;
+    }
 
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)(2 * sizeof(float)));
-    glEnableVertexAttribArray(1);
+    std::cout << "Computer plays " << moveToNotation(result.bestMove)
+        << " (depth " << result.depth << ", score " << result.score << ", nodes " << result.nodes
+        << ", " << (uint64_t)(result.seconds > 0 ? result.nodes / result.seconds : 0) << " nodes/s, "
+        << engine.getThreads() << " threads)" << std::endl;
 
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+    // Vrijeme razmišljanja ide na sat računara, prije nego što finishTurn promijeni stranu
+    settleClock();
+    playMove(result.bestMove);
+    finishTurn(window);
 }
 
-void drawPossibleMoves(const std::vector<Position>& moves, unsigned int shader, unsigned int VAO) {
-    glUseProgram(shader);
-
-    // Učitaj lokacije uniformi samo jednom
-    unsigned int colorLoc = glGetUniformLocation(shader, "moveColor");
-    unsigned int modelLoc = glGetUniformLocation(shader, "model");
-
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-    glBindVertexArray(VAO);
-
-    for (const auto& move : moves) {
-        // Provjeri da li je na potezu neprijateljska figura
-        Piece* occupyingPiece = board[move.getRow()][move.getColumn()];
-        bool isAttackMove = occupyingPiece != nullptr && occupyingPiece->getColor() != selectedPiece->getColor();
-
-        // Postavi boju poteza
-        glm::vec4 moveColor = isAttackMove
-            ? glm::vec4(1.0f, 0.0f, 0.0f, 1.0f) // Crvena za napad
-            : glm::vec4(0.0f, 0.0f, 0.0f, 1.0f); // Crna za slobodne poteze
-        glUniform4fv(colorLoc, 1, glm::value_ptr(moveColor));
-
-        // Postavi model matricu za pozicioniranje na odgovarajuće mjesto na tabli
-        glm::mat4 model = glm::translate(glm::mat4(1.0f), glm::vec3(move.getXGL(), move.getYGL(), 0.0f));
-        glUniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(model));
-
-        // Nacrtaj potez
-        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-    }
-
-    glBindVertexArray(0);
-    glUseProgram(0);
-}
 
 
 
-bool isCheckmate(const std::vector<std::unique_ptr<Piece>>& pieces, std::vector<std::vector<Piece*>>& board, Color kingColor) {
-    if (!Piece::isKingInCheck(pieces, board, kingColor)) {
-        std::cout << "Kralj nije u šahu." << std::endl;
+// Pozicija iz FEN zapisa se postavlja na tablu, a figure za prikaz se prave iz table.
+// FEN se čita u pomoćnu tablu, pa neispravan zapis ne dira partiju koja je u toku.
+bool initializeChessPieces(const char* fen) {
+    static Board parsed;                       // Statična zbog veličine istorije poteza
+    if (!parsed.loadFen(fen)) {
         return false;
     }
 
-    std::cout << "Kralj je u šahu." << std::endl;
-
-    Position kingPosition;
-    std::vector<Position> kingMoves;
+    settleClock();
+    cancelEngineSearch();                      // Rezultat pretrage važi za poziciju koja se zamjenjuje
+    board = parsed;
+    pieces.loadFromBoard(board);
+    selectedPiece = -1;
+    selectedMoves.clear();
+    isWhiteTurn = board.getSideToMove() == Color::White;
+    invalidate(DirtyAll);
+    return true;
+}
 
-    // Pronađi kralja i njegove poteze
-    for (const auto& piece : pieces) {
-        if (piece->getType() == PieceType::King && piece->getColor() == kingColor) {
-            kingPosition = piece->getCurrentPosition();
-            piece->calculatePossibleMoves(board);
-            kingMoves = piece->getPossibleMoves();
-            break;
-        }
-    }
+void invalidate(int regions) {
+    dirtyRegions |= regions;
+}
 
-    // Lambda za provjeru da li je polje napadnuto od strane protivnika
-    auto isSquareAttackedByOpponent = [&](int r, int c, Color friendColor) {
-        for (const auto& p : pieces) {
-            if (p->getColor() != friendColor) {
-                p->calculatePossibleMoves(board);
-                for (const auto& m : p->getPossibleMoves()) {
-                    if (m.getRow() == r && m.getColumn() == c) {
-                        return true;
-                    }
-                }
-            }
+// Vrijeme proteklo od lastTime se oduzima strani koja je na potezu (osim za vrijeme pauze)
+void settleClock() {
+    double now = glfwGetTime();
+    if (!isPaused) {
+        if (isWhiteTurn) {
+            whiteTimeLeft -= now - lastTime;
         }
-        return false;
-    };
-
-    // Pronađi sve napadačke figure
-    std::vector<Piece*> attackingPieces;
-    for (const auto& piece : pieces) {
-        if (piece->getColor() != kingColor) {
-            piece->calculatePossibleMoves(board);
-            for (const auto& move : piece->getPossibleMoves()) {
-                if (move.getRow() == kingPosition.getRow() && move.getColumn() == kingPosition.getColumn()) {
-                    attackingPieces.push_back(piece.get());
-                }
-            }
+        else {
+            blackTimeLeft -= now - lastTime;
         }
     }
+    lastTime = now;
+}
 
-    // Ako ima više napadača, šah-mat
-    if (attackingPieces.size() > 1) {
-        std::cout << "Više od jednog napadača. Šah-mat." << std::endl;
-        return true;
-    }
-
-    Piece* attackingPiece = attackingPieces.front();
-    Position attackerPosition = attackingPiece->getCurrentPosition();
-
-    // 1. Provjera da li kralj može pobjeći ili pojesti napadača
-    for (const auto& move : kingMoves) {
-        int row = move.getRow();
-        int col = move.getColumn();
-
-        // Ako je potez upravo na mesto napadača, pokušaj da pojedeš napadača
-        if (move == attackerPosition) {
-            // Privremeno skloni napadača
-            Piece* tempAttacker = board[row][col];
-            board[row][col] = nullptr;
-
-            // Provjeri da li je polje i dalje pod napadom
-            bool isUnderAttack = isSquareAttackedByOpponent(row, col, kingColor);
-
-            // Vrati napadača privremeno (da kasnije možeš simulirati potez)
-            board[row][col] = tempAttacker;
-
-            if (!isUnderAttack) {
-                // Simuliraj da kralj jede napadača
-                Piece* temp = board[row][col];
-                board[row][col] = board[kingPosition.getRow()][kingPosition.getColumn()];
-                board[kingPosition.getRow()][kingPosition.getColumn()] = nullptr;
-                attackingPiece->clearPossibleMoves();
-                Position oldAttackerPosition = attackingPiece->getCurrentPosition();
-                attackingPiece->setCurrentPosition(Position(-1, -1));
-
-                bool stillInCheck = Piece::isKingInCheck(pieces, board, kingColor);
-
-                // Vrati stanje
-                board[kingPosition.getRow()][kingPosition.getColumn()] = board[row][col];
-                board[row][col] = temp;
+// Vrijeme do sljedeće promjene prikazane sekunde na satu koji teče
+double secondsUntilClockTick() {
+    double timeLeft = isWhiteTurn ? whiteTimeLeft : blackTimeLeft;
+    return timeLeft - std::floor(timeLeft) + 0.001;
+}
 
-                attackingPiece->setCurrentPosition(oldAttackerPosition);
 
-                if (!stillInCheck) {
-                    // Kralj može bezbedno pojesti napadača
-                    return false;
-                }
-
-            }
-        } else {
-            bool isUnderAttack = isSquareAttackedByOpponent(row, col, kingColor);
-            if (!isUnderAttack) {
-                // Simuliraj potez kralja
-                Piece* temp = board[row][col];
-                board[row][col] = board[kingPosition.getRow()][kingPosition.getColumn()];
-                board[kingPosition.getRow()][kingPosition.getColumn()] = nullptr;
-
-                bool stillInCheck = Piece::isKingInCheck(pieces, board, kingColor);
-
-                // Vrati tablu u prethodno stanje
-                board[kingPosition.getRow()][kingPosition.getColumn()] = board[row][col];
-                board[row][col] = temp;
-
-                if (!stillInCheck) {
-                    return false; // Kralj može povjeci
-                }
-            }
+// Statični dio table: slika table, istaknut posljednji potez i, po želji, oznake kolona i redova.
+// Crta se u viewport 800x800 table.
+void drawBoardLayer(const BasicProgram& program, unsigned int VAO, unsigned int texture, unsigned int moveVAO,
+    TextRenderer& textRenderer, const TextProgram& textProgram) {
+    drawChessboard(program, VAO, texture);
+
+    Move lastMove = board.getLastMove();
+    if (lastMove.raw() != 0) {
+        glState.useProgram(program.id);
+        glUniform4f(program.spriteRect, 0.0f, 0.0f, 1.0f, 1.0f);
+        glState.bindVertexArray(moveVAO);
+        glUniform1i(program.solidColor, 1);
+        glUniform4f(program.moveColor, 1.0f, 0.85f, 0.2f, 0.35f);
+
+        // Kvadrat poteza je 0.1 široko, a polje 0.25
+        Square squares[2] = { (Square)lastMove.from(), (Square)lastMove.to() };
+        for (Square square : squares) {
+            NdcPoint center = squareToNdc(square);
+            glm::mat4 model = glm::translate(glm::mat4(1.0f), glm::vec3(center.x, center.y, 0.0f));
+            model = glm::scale(model, glm::vec3(2.5f, 2.5f, 1.0f));
+            glUniformMatrix4fv(program.model, 1, GL_FALSE, glm::value_ptr(model));
+            glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
         }
+        glUniform1i(program.solidColor, 0);
     }
 
-    // 2. Provjera da li neko može pojesti napadača (osim kralja, jer smo to već obradili)
-    for (const auto& piece : pieces) {
-        if (piece->getColor() == kingColor && piece->getType() != PieceType::King) {
-            piece->calculatePossibleMoves(board);
-            for (const auto& move : piece->getPossibleMoves()) {
-                if (move == attackerPosition) {
-                    // Simuliraj potez
-                    Piece* temp = board[move.getRow()][move.getColumn()];
-                    Position oldPos = piece->getCurrentPosition();
-
-                    board[move.getRow()][move.getColumn()] = piece.get();
-                    board[oldPos.getRow()][oldPos.getColumn()] = nullptr;
-
-                    // Ako hvatamo neprijateljsku figuru - napadača,
-                    // privremeno je ukloni iz kalkulacija
-                    Position oldAttackerPos = Position(-1, -1);
-                    bool capturedEnemy = false;
-
-                    if (temp != nullptr && temp->getColor() != kingColor) {
-                        oldAttackerPos = temp->getCurrentPosition();
-                        temp->setCurrentPosition(Position(-1, -1));
-                        capturedEnemy = true;
-                    }
-
-                    bool stillInCheck = Piece::isKingInCheck(pieces, board, kingColor);
-
-                    // Vrati tablu u prethodno stanje
-                    board[oldPos.getRow()][oldPos.getColumn()] = piece.get();
-                    board[move.getRow()][move.getColumn()] = temp;
-
-                    // Vrati napadača na staru poziciju, ako smo ga pomjerali
-                    if (capturedEnemy && temp != nullptr) {
-                        temp->setCurrentPosition(oldAttackerPos);
-                    }
-
-                    if (!stillInCheck) {
-                        // Neka figura može pojesti napadača i spasiti kralja
-                        return false;
-                    }
-                }
-            }
+    if (showCoordinates) {
+        // Tekst se privremeno projektuje na cijelu tablu umjesto na zaglavlje
+        textRenderer.setProjection(textProgram, 800, 800);
+        glm::vec3 color(0.15f, 0.15f, 0.15f);
+        for (int i = 0; i < 8; ++i) {
+            textRenderer.renderText(textProgram, std::string(1, (char)('a' + i)), i * 100.0f + 86.0f, 4.0f, 0.35f, color);
+            textRenderer.renderText(textProgram, std::string(1, (char)('1' + i)), 4.0f, i * 100.0f + 82.0f, 0.35f, color);
         }
+        textRenderer.setProjection(textProgram, 800, 100);
     }
+}
 
+void drawPossibleMoves(const std::vector<Square>& moves, const BasicProgram& program, unsigned int VAO) {
+    glState.useProgram(program.id);
+    glUniform4f(program.spriteRect, 0.0f, 0.0f, 1.0f, 1.0f);
 
-    // 3. Ako napadač može biti blokiran (važi za lovca, topa, kraljicu)
-    if (attackingPiece->getType() == PieceType::Rook ||
-        attackingPiece->getType() == PieceType::Bishop ||
-        attackingPiece->getType() == PieceType::Queen) {
-        Position blockPosition = attackerPosition;
-
-        int rowDirection = (kingPosition.getRow() > blockPosition.getRow()) ? 1 : (kingPosition.getRow() < blockPosition.getRow()) ? -1 : 0;
-        int colDirection = (kingPosition.getColumn() > blockPosition.getColumn()) ? 1 : (kingPosition.getColumn() < blockPosition.getColumn()) ? -1 : 0;
-
-        while (blockPosition != kingPosition) {
-            blockPosition.setRow(blockPosition.getRow() + rowDirection);
-            blockPosition.setColumn(blockPosition.getColumn() + colDirection);
-
-            if (blockPosition.getRow() < 0 || blockPosition.getRow() >= (int)board.size() ||
-                blockPosition.getColumn() < 0 || blockPosition.getColumn() >= (int)board[0].size()) {
-                break;
-            }
-
-            for (const auto& piece : pieces) {
-                if (piece->getColor() == kingColor && piece->getType() != PieceType::King) {
-                    piece->calculatePossibleMoves(board);
-                    for (const auto& m : piece->getPossibleMoves()) {
-                        if (m == blockPosition) {
-                            Piece* temp = board[m.getRow()][m.getColumn()];
-                            Position oldPos = piece->getCurrentPosition();
+    // Kvadrat se boji samo sa moveColor, pa ne zavisi od teksture koja je ostala vezana (atlas figura)
+    glUniform1i(program.solidColor, 1);
+    glState.bindVertexArray(VAO);
 
-                            board[m.getRow()][m.getColumn()] = piece.get();
-                            board[oldPos.getRow()][oldPos.getColumn()] = nullptr;
+    for (Square target : moves) {
+        // Provjeri da li je na potezu neprijateljska figura
+        bool isAttackMove = board.hasPieceOf(oppositeColor(pieces.getColor(selectedPiece)), target);
 
-                            bool isStillInCheck = Piece::isKingInCheck(pieces, board, kingColor);
+        // Postavi boju poteza
+        glm::vec4 moveColor = isAttackMove
+            ? glm::vec4(1.0f, 0.0f, 0.0f, 1.0f) // Crvena za napad
+            : glm::vec4(0.0f, 0.0f, 0.0f, 1.0f); // Crna za slobodne poteze
+        glUniform4fv(program.moveColor, 1, glm::value_ptr(moveColor));
 
-                            // Vrati stanje
-                            board[oldPos.getRow()][oldPos.getColumn()] = piece.get();
-                            board[m.getRow()][m.getColumn()] = temp;
+        // Postavi model matricu za pozicioniranje na odgovarajuće mjesto na tabli
+        NdcPoint center = squareToNdc(target);
+        glm::mat4 model = glm::translate(glm::mat4(1.0f), glm::vec3(center.x, center.y, 0.0f));
+        glUniformMatrix4fv(program.model, 1, GL_FALSE, glm::value_ptr(model));
 
-                            if (!isStillInCheck) {
-                                return false; // Napad može biti blokiran
-                            }
-                        }
-                    }
-                }
-            }
-        }
+        // Nacrtaj potez
+        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
     }
 
-    // Ako ništa od navedenog ne pomaže, to je šah-mat
-    std::cout << "Šah-mat." << std::endl;
-    return true;
+    glUniform1i(program.solidColor, 0);
 }